@@ -0,0 +1,573 @@
+//
+//  Part of libJSON, licensed under the GNU Lesser General Public License v3.
+//  Copyright © 2026 the libJSON contributors.
+//
+
+#include <libJSON/libJSON.hxx>
+#include <libJSON/JSONDocument.hxx>
+#include <libJSON/BasicJSONParser.hxx>
+#include <libJSON/ParallelJSONParser.hxx>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <new>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cstdlib>
+
+namespace
+{
+    /// The number of operator new calls of the whole program.
+    std::atomic<std::size_t> allocations(0);
+}
+
+// Not inlined, so GCC does not see free() on a pointer from operator new (-Wmismatched-new-delete).
+__attribute__((noinline)) void * operator new(std::size_t size)
+{
+    ++allocations;
+    if (void * memory = std::malloc(size ? size : 1))
+        return memory;
+    throw std::bad_alloc();
+}
+
+__attribute__((noinline)) void * operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+__attribute__((noinline)) void operator delete(void * memory) noexcept
+{
+    std::free(memory);
+}
+
+__attribute__((noinline)) void operator delete(void * memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+__attribute__((noinline)) void operator delete[](void * memory) noexcept
+{
+    operator delete(memory);
+}
+
+__attribute__((noinline)) void operator delete[](void * memory, std::size_t) noexcept
+{
+    operator delete(memory);
+}
+
+namespace
+{
+    void appendElement(std::string & document, unsigned i)
+    {
+        if (i)
+            document.append(",\n");
+        document.append("{\"id\": ").append(std::to_string(i))
+                .append(", \"value\": -").append(std::to_string(i % 1000)).append(".5e-3")
+                .append(", \"name\": \"item ").append(std::to_string(i))
+                .append("\", \"tags\": [true, false, null]}");
+    }
+
+    std::string largeArray(std::size_t size)
+    {
+        std::string document("[");
+        for (unsigned i = 0; document.size() < size; ++i)
+            appendElement(document, i);
+        return document.append("]");
+    }
+
+    ///
+    /// The elements of largeArray() as newline delimited JSON.
+    ///
+    std::string lines(std::size_t size)
+    {
+        std::string document;
+        for (unsigned i = 0; document.size() < size; ++i)
+        {
+            std::size_t start = document.size();
+            appendElement(document, i);
+            if (i)
+                document.erase(start, 2); // the ",\n" in front of an array element
+            document.push_back('\n');
+        }
+        return document;
+    }
+
+    std::string numericArray(std::size_t size)
+    {
+        std::string document("[");
+        for (unsigned i = 0; document.size() < size; ++i)
+        {
+            if (i)
+                document.append(", ");
+            document.append(std::to_string(i * 7919u)).append(", -")
+                    .append(std::to_string(i % 100000)).append(".").append(std::to_string(i % 977)).append("e-")
+                    .append(std::to_string(i % 20)).append(", 0.").append(std::to_string(i * 2654435761u));
+        }
+        return document.append("]");
+    }
+
+    std::string nestedObjects(std::size_t depth)
+    {
+        std::string document;
+        for (std::size_t i = 0; i < depth; ++i)
+            document.append("{\"a\": [");
+        document.append("0");
+        for (std::size_t i = 0; i < depth; ++i)
+            document.append("]}");
+        return document;
+    }
+
+    ///
+    /// An array of nestedObjects() of the given depth.
+    ///
+    std::string nestedArray(std::size_t size, std::size_t depth)
+    {
+        std::string element = nestedObjects(depth);
+        std::string document("[");
+        for (unsigned i = 0; document.size() < size; ++i)
+            document.append(i ? ",\n" : "").append(element);
+        return document.append("]");
+    }
+
+    ///
+    /// An array of strings, with plain text and all kinds of escapes.
+    ///
+    std::string stringArray(std::size_t size)
+    {
+        std::string document("[");
+        for (unsigned i = 0; document.size() < size; ++i)
+            document.append(i ? ",\n" : "").append("\"item ").append(std::to_string(i))
+                    .append(i % 4 ? " plain text without any escapes at all\"" :
+                            ": \\\"quoted\\\", back\\\\slash\\/\\b\\f\\n\\r\\t \\u00e9\\u20ac \\ud83d\\ude00 caf\xc3\xa9\"");
+        return document.append("]");
+    }
+
+    ///
+    /// An array of objects with the given number of members each.
+    ///
+    std::string wideObjects(std::size_t size, unsigned members)
+    {
+        std::string document("[");
+        for (unsigned i = 0; document.size() < size; ++i)
+        {
+            document.append(i ? ",\n{" : "{");
+            for (unsigned member = 0; member < members; ++member)
+            {
+                document.append(member ? ", \"field" : "\"field").append(std::to_string(member)).append("\": ");
+                if (member % 3)
+                    document.append(std::to_string(i * members + member));
+                else
+                    document.append("\"value ").append(std::to_string(member)).append("\"");
+            }
+            document.append("}");
+        }
+        return document.append("]");
+    }
+
+    void run(const char * name, const std::string & document, bool zeroCopy = false)
+    {
+        std::unique_ptr<libJSON::SimpleJSONParser> simpleJSONParser(libJSON::SimpleJSONParser::Create(false, zeroCopy));
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        *simpleJSONParser << document;
+        std::chrono::duration<double> seconds = std::chrono::steady_clock::now() - start;
+        std::cout << name << ": " << document.size() << " bytes in " << seconds.count() << " s, "
+                  << document.size() / seconds.count() / (1024 * 1024) << " MB/s" << std::endl;
+    }
+
+    ///
+    /// Converts all numbers of the document, either with strtod() after tokenizing or
+    /// with the tokenizer's single pass decode.
+    ///
+    void runNumbers(const char * name, const std::string & document, bool decode)
+    {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        libJSONImpl::JSONTokenizer tokenizer(document.data(), document.data() + document.size());
+        libJSONImpl::JSONToken token;
+        tokenizer.zeroCopy = true;
+        tokenizer.decode = decode;
+        double sum = 0;
+        do
+        {
+            tokenizer.next(token);
+            if (token.tag != libJSONImpl::NUMBER)
+                continue;
+            else if (!decode)
+                sum += std::strtod(token.text.data(), 0); // stops at the delimiter behind the token
+            else if (token.number.type == libJSON::JSONNumber::INTEGER)
+                sum += token.number.integer;
+            else if (token.number.type == libJSON::JSONNumber::UNSIGNED)
+                sum += token.number.unsignedInteger;
+            else
+                sum += token.number.real;
+        }
+        while (token.tag != libJSONImpl::eof);
+        std::chrono::duration<double> seconds = std::chrono::steady_clock::now() - start;
+        std::cout << name << ": " << document.size() << " bytes in " << seconds.count() << " s, "
+                  << document.size() / seconds.count() / (1024 * 1024) << " MB/s (sum " << sum << ")" << std::endl;
+    }
+
+    ///
+    /// The tree every team used to write: one allocation per value, member and key.
+    ///
+    struct NaiveValue
+    {
+        libJSON::JSONValue::Type type;
+        double number;
+        std::string string;
+        std::vector<NaiveValue> array;
+        std::map<std::string, NaiveValue> object;
+
+        NaiveValue(libJSON::JSONValue::Type type = libJSON::JSONValue::NULL_VALUE, double number = 0) : type(type), number(number) {}
+    };
+
+    class NaiveBuilder : public libJSON::JSONHandler
+    {
+    public:
+
+        NaiveValue root;
+
+        void boolean(unsigned line, unsigned column, std::string_view text) { add(NaiveValue(libJSON::JSONValue::BOOLEAN, text == "true")); }
+        void null(unsigned line, unsigned column, std::string_view text) { add(NaiveValue()); }
+        void decodedNumber(unsigned line, unsigned column, const libJSON::JSONNumber & number)
+        {
+            add(NaiveValue(libJSON::JSONValue::REAL, number.type == libJSON::JSONNumber::REAL ? number.real : number.integer));
+        }
+        void decodedString(unsigned line, unsigned column, std::string_view text)
+        {
+            if (!path.empty() && path.back().second)
+            {
+                keys.emplace_back(text);
+                path.back().second = false;
+            }
+            else
+            {
+                NaiveValue value(libJSON::JSONValue::STRING);
+                value.string = text;
+                add(std::move(value));
+            }
+        }
+        void startArray(unsigned line, unsigned column, std::string_view text) { open(libJSON::JSONValue::ARRAY); }
+        void startObject(unsigned line, unsigned column, std::string_view text) { open(libJSON::JSONValue::OBJECT); }
+        void nextElement(unsigned line, unsigned column, std::string_view text) { path.back().second = path.back().first->type == libJSON::JSONValue::OBJECT; }
+        void endArray(unsigned line, unsigned column, std::string_view text) { path.pop_back(); }
+        void endObject(unsigned line, unsigned column, std::string_view text) { path.pop_back(); }
+
+    private:
+
+        NaiveValue * add(NaiveValue && value)
+        {
+            if (path.empty())
+                return &(root = std::move(value));
+            NaiveValue & parent = *path.back().first;
+            if (parent.type == libJSON::JSONValue::ARRAY)
+            {
+                parent.array.push_back(std::move(value));
+                return &parent.array.back();
+            }
+            NaiveValue * member = &(parent.object[keys.back()] = std::move(value));
+            keys.pop_back();
+            return member;
+        }
+
+        void open(libJSON::JSONValue::Type type)
+        {
+            path.emplace_back(add(NaiveValue(type)), type == libJSON::JSONValue::OBJECT);
+        }
+
+        std::vector<std::pair<NaiveValue *, bool> > path; // open containers, expecting a key
+        std::vector<std::string> keys;
+    };
+
+    ///
+    /// Parses, builds and destroys a tree of the document a number of times.
+    ///
+    void runTrees(const std::string & document, unsigned repeat)
+    {
+        const char * names[] = {"tree, std::map nodes", "tree, new JSONDocument", "tree, reused JSONDocument"};
+        libJSON::JSONDocument reused;
+        for (int kind = 0; kind < 3; ++kind)
+        {
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            for (unsigned i = 0; i < repeat; ++i)
+            {
+                if (kind == 0)
+                {
+                    NaiveBuilder naiveBuilder;
+                    libJSON::BasicJSONParser<NaiveBuilder> parser(naiveBuilder, true);
+                    parser << document;
+                }
+                else if (kind == 1)
+                {
+                    libJSON::JSONDocument jsonDocument;
+                    jsonDocument.parse(document);
+                }
+                else
+                    reused.parse(document);
+            }
+            std::chrono::duration<double> seconds = std::chrono::steady_clock::now() - start;
+            std::cout << names[kind] << ": " << repeat << " x " << document.size() << " bytes in " << seconds.count() << " s, "
+                      << repeat * document.size() / seconds.count() / (1024 * 1024) << " MB/s" << std::endl;
+        }
+    }
+
+    ///
+    /// Counts the tokens, so the time per token of the callback dispatch can be compared.
+    ///
+    struct TokenCounter : public libJSON::JSONHandler
+    {
+        std::size_t tokens;
+
+        TokenCounter() : tokens(0) {}
+
+        void boolean(unsigned line, unsigned column, std::string_view text) { ++tokens; }
+        void endArray(unsigned line, unsigned column, std::string_view text) { ++tokens; }
+        void endObject(unsigned line, unsigned column, std::string_view text) { ++tokens; }
+        void memberValue(unsigned line, unsigned column, std::string_view text) { ++tokens; }
+        void nextElement(unsigned line, unsigned column, std::string_view text) { ++tokens; }
+        void null(unsigned line, unsigned column, std::string_view text) { ++tokens; }
+        void number(unsigned line, unsigned column, std::string_view number) { ++tokens; }
+        void space(unsigned line, unsigned column, std::string_view text) { ++tokens; }
+        void startArray(unsigned line, unsigned column, std::string_view text) { ++tokens; }
+        void startObject(unsigned line, unsigned column, std::string_view text) { ++tokens; }
+        void string(unsigned line, unsigned column, std::string_view text) { ++tokens; }
+    };
+
+    ///
+    /// The time per token of the virtual SimpleJSONParser callbacks and of a BasicJSONParser,
+    /// which calls its handler statically. The overhead is the time above the tokenizer alone;
+    /// each variant reports its best of a few runs.
+    ///
+    void runDispatch(const std::string & document, unsigned repeat)
+    {
+        const char * names[] = {"dispatch, tokenizer only", "dispatch, BasicJSONParser<TokenCounter>",
+                                "dispatch, virtual zero-copy callbacks", "dispatch, virtual std::string callbacks"};
+        std::size_t tokens = 0;
+        double tokenizer = 0;
+        for (int kind = 0; kind < 4; ++kind)
+        {
+            double best = 0;
+            for (unsigned i = 0; i < repeat; ++i)
+            {
+                std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+                if (kind == 0)
+                {
+                    libJSONImpl::JSONTokenizer jsonTokenizer(document.data(), document.data() + document.size());
+                    libJSONImpl::JSONToken token;
+                    jsonTokenizer.zeroCopy = true;
+                    tokens = 0;
+                    do
+                    {
+                        jsonTokenizer.next(token);
+                        tokens += token.tag != libJSONImpl::eof;
+                    }
+                    while (token.tag != libJSONImpl::eof);
+                }
+                else if (kind == 1)
+                {
+                    TokenCounter tokenCounter;
+                    libJSON::BasicJSONParser<TokenCounter> parser(tokenCounter);
+                    parser << document;
+                }
+                else
+                {
+                    std::unique_ptr<libJSON::SimpleJSONParser> simpleJSONParser(libJSON::SimpleJSONParser::Create(false, kind == 2));
+                    *simpleJSONParser << document;
+                }
+                std::chrono::duration<double> seconds = std::chrono::steady_clock::now() - start;
+                if (i == 0 || seconds.count() < best)
+                    best = seconds.count();
+            }
+            if (kind == 0)
+                tokenizer = best;
+            std::cout << names[kind] << ": " << tokens << " tokens in " << best << " s, "
+                      << best * 1e9 / tokens << " ns/token";
+            if (kind)
+                std::cout << ", overhead " << (best - tokenizer) * 1e9 / tokens << " ns/token";
+            std::cout << std::endl;
+        }
+    }
+
+    ///
+    /// The tokenizer alone with each scan kernel the CPU supports, e.g. on string-heavy documents,
+    /// where the string kernel skips most of the input.
+    ///
+    void runTokenizer(const char * name, const std::string & document)
+    {
+        std::vector<const libJSONImpl::JSONScanKernels *> kernels = {&libJSONImpl::JSONScanKernels::scalar(),
+                                                                     libJSONImpl::JSONScanKernels::sse2(),
+                                                                     libJSONImpl::JSONScanKernels::avx2()};
+        for (const libJSONImpl::JSONScanKernels * kernel : kernels)
+        {
+            if (!kernel)
+                continue;
+            libJSONImpl::JSONTokenizer tokenizer(document.data(), document.data() + document.size());
+            libJSONImpl::JSONToken token;
+            tokenizer.kernels = kernel;
+            tokenizer.zeroCopy = true;
+            std::size_t tokens = 0;
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            do
+            {
+                tokenizer.next(token);
+                ++tokens;
+            }
+            while (token.tag != libJSONImpl::eof);
+            std::chrono::duration<double> seconds = std::chrono::steady_clock::now() - start;
+            std::cout << name << ", " << kernel->name << " kernels: " << document.size() << " bytes in " << seconds.count() << " s, "
+                      << document.size() / seconds.count() / (1024 * 1024) << " MB/s, " << tokens << " tokens" << std::endl;
+        }
+    }
+
+    ///
+    /// Parses a corpus into callbacks and into a reused JSONDocument and reports MB/s, tokens/s and
+    /// the operator new calls per document. Newline delimited JSON counts every line as a document.
+    /// With LIBJSON_STATISTICS, the parser's counters of the callback run are dumped as well.
+    ///
+    void runCorpus(const char * name, const std::string & document, bool lines = false)
+    {
+        const char * begin = document.data();
+        const char * end = begin + document.size();
+        TokenCounter tokenCounter;
+        libJSON::BasicJSONParser<TokenCounter> parser(tokenCounter, true);
+        libJSON::JSONDocument reused;
+        for (int tree = 0; tree < 2; ++tree)
+        {
+            std::size_t documents = 0;
+            std::size_t before = allocations;
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            for (const char * line = begin; line < end; ++documents)
+            {
+                const char * next = lines ? static_cast<const char *>(std::memchr(line, '\n', end - line)) : 0;
+                if (!next)
+                    next = end;
+                if (tree)
+                    reused.parse(line, next);
+                else
+                    parser.parse(line, next);
+                line = next + 1;
+            }
+            std::chrono::duration<double> seconds = std::chrono::steady_clock::now() - start;
+            std::cout << name << (tree ? ", reused JSONDocument: " : ", callbacks: ") << document.size() << " bytes in "
+                      << seconds.count() << " s, " << document.size() / seconds.count() / (1024 * 1024) << " MB/s, ";
+            if (!tree)
+                std::cout << tokenCounter.tokens / seconds.count() / 1e6 << " M tokens/s, ";
+            std::cout << static_cast<double>(allocations - before) / documents << " allocations/document" << std::endl;
+        }
+        if (libJSONImpl::JSONStatistics::enabled)
+            std::cout << parser.statistics << std::endl;
+    }
+
+    ///
+    /// Pushes the document in pieces of the given size, as if it was read from a socket.
+    ///
+    void runPushed(const std::string & document, std::size_t pieceSize)
+    {
+        TokenCounter tokenCounter;
+        libJSON::BasicJSONParser<TokenCounter> parser(tokenCounter);
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for (std::size_t offset = 0; offset < document.size(); offset += pieceSize)
+            parser.feed(document.data() + offset, std::min(pieceSize, document.size() - offset));
+        parser.finish();
+        std::chrono::duration<double> seconds = std::chrono::steady_clock::now() - start;
+        std::cout << "pushed in " << pieceSize << " byte pieces: " << document.size() << " bytes in " << seconds.count() << " s, "
+                  << document.size() / seconds.count() / (1024 * 1024) << " MB/s, " << tokenCounter.tokens << " tokens" << std::endl;
+    }
+
+    ///
+    /// Parses a large array and its elements as newline delimited JSON with 1 up to threads workers,
+    /// with a handler per worker and in document order. The speedup is relative to one worker.
+    ///
+    void runParallel(std::size_t size, unsigned threads)
+    {
+        typedef libJSON::ParallelJSONParser<TokenCounter> ParallelParser;
+        for (ParallelParser::Format format : {ParallelParser::ARRAY, ParallelParser::LINES})
+        {
+            std::string document = format == ParallelParser::ARRAY ? largeArray(size) : lines(size);
+            const char * name = format == ParallelParser::ARRAY ? "parallel array" : "parallel lines";
+            double single[2] = {0, 0};
+            for (unsigned workers = 1; ; workers = std::min(2 * workers, threads))
+            {
+                libJSON::JSONThreadPool pool(workers);
+                ParallelParser parser(pool, format);
+                double seconds[2];
+                std::size_t tokens[2] = {0, 0};
+                for (int ordered = 0; ordered < 2; ++ordered)
+                {
+                    std::vector<TokenCounter> handlers(ordered ? 1 : workers);
+                    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+                    if (ordered)
+                        parser.parse(document, handlers[0]);
+                    else
+                        parser.parse(document, handlers);
+                    seconds[ordered] = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+                    for (const TokenCounter & handler : handlers)
+                        tokens[ordered] += handler.tokens;
+                    if (workers == 1)
+                        single[ordered] = seconds[ordered];
+                }
+                std::cout << name << ", " << workers << " threads: " << document.size() << " bytes, " << tokens[0] << " tokens, per worker "
+                          << document.size() / seconds[0] / (1024 * 1024) << " MB/s (x" << single[0] / seconds[0] << "), in order "
+                          << document.size() / seconds[1] / (1024 * 1024) << " MB/s (x" << single[1] / seconds[1] << ")"
+                          << (tokens[0] == tokens[1] ? "" : ", token counts differ") << std::endl;
+                if (workers == threads)
+                    break;
+            }
+        }
+    }
+}
+
+int main(int argc, char * args[])
+{
+    try
+    {
+        std::size_t megabytes = argc > 1 ? std::strtoul(args[1], 0, 10) : 50;
+        std::size_t depth = argc > 2 ? std::strtoul(args[2], 0, 10) : 10000;
+        std::size_t parallelMegabytes = argc > 3 ? std::strtoul(args[3], 0, 10) : megabytes;
+        unsigned threads = argc > 4 ? std::strtoul(args[4], 0, 10) : std::max(1u, std::thread::hardware_concurrency());
+
+        std::string document = largeArray(megabytes * 1024 * 1024);
+        run("large array", document);
+        run("large array (zero-copy)", document, true);
+        run("nested objects", nestedObjects(depth));
+
+        runTrees(largeArray(10 * 1024 * 1024), 5);
+        runDispatch(largeArray(10 * 1024 * 1024), 5);
+        document = largeArray(10 * 1024 * 1024);
+        runPushed(document, 1500);
+        runPushed(document, 64 * 1024);
+
+        document = stringArray(megabytes * 1024 * 1024);
+        runTokenizer("tokenizer only, strings", document);
+
+        document = numericArray(megabytes * 1024 * 1024);
+        runNumbers("numbers, tokenize then strtod", document, false);
+        runNumbers("numbers, single pass decode", document, true);
+        document.clear();
+        document.shrink_to_fit();
+
+        std::size_t corpusSize = std::min<std::size_t>(megabytes, 10) * 1024 * 1024;
+        runCorpus("corpus numbers", numericArray(corpusSize));
+        runCorpus("corpus strings", stringArray(corpusSize));
+        runCorpus("corpus nested", nestedArray(corpusSize, 64));
+        runCorpus("corpus wide objects", wideObjects(corpusSize, 200));
+        runCorpus("corpus NDJSON", lines(corpusSize), true);
+
+        runParallel(parallelMegabytes * 1024 * 1024, threads);
+    }
+    catch (const std::exception & exception)
+    {
+        std::cerr << std::endl << exception.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+    catch (...)
+    {
+        std::cerr << std::endl << "unknown error" << std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,440 @@
+//
+//  Part of libJSON, licensed under the GNU Lesser General Public License v3.
+//  Copyright © 2026 the libJSON contributors.
+//
+
+#ifndef BasicJSONParser_hxx
+#define BasicJSONParser_hxx
+
+#include <libJSON/JSONTokenizer.hxx>
+#include <sstream>
+#include <vector>
+
+namespace libJSONImpl
+{
+    ///
+    /// An open '[' or '{' on the parse stack. Only the tag and the position are kept,
+    /// so the parse stack is bounded by the nesting depth and not by the document size.
+    ///
+    struct JSONFrame
+    {
+        JSONTagType tag;
+        unsigned line;
+        unsigned column;
+
+        JSONFrame(const JSONToken & token) : tag(token.tag), line(token.line), column(token.column) {}
+        JSONFrame(JSONTagType tag, unsigned line, unsigned column) : tag(tag), line(line), column(column) {}
+    };
+
+    ///
+    /// The states of the pushdown automaton recognizing the grammar of JSONTagType.
+    /// Each state is an LR item set; the container nesting is kept on a separate stack.
+    ///
+    typedef enum
+    {
+        P_DOCUMENT,         // JSON -> . value eof
+        P_DOCUMENT_END,     // JSON -> value . eof
+        P_ARRAY_FIRST,      // array -> '[' . ']' | '[' . values ']'
+        P_ARRAY_NEXT,       // array -> '[' values . ']', values -> values . ',' value
+        P_ARRAY_VALUE,      // values -> values ',' . value
+        P_OBJECT_FIRST,     // object -> '{' . '}' | '{' . members '}'
+        P_OBJECT_COLON,     // member -> STRING . ':' value
+        P_OBJECT_VALUE,     // member -> STRING ':' . value
+        P_OBJECT_NEXT,      // object -> '{' members . '}', members -> members . ',' member
+        P_OBJECT_MEMBER,    // members -> members ',' . member
+        P_ACCEPT,           // JSON -> value eof .
+    } JSONParseState;
+
+    typedef enum
+    {
+        A_ERROR,            // the terminal can not continue a valid prefix
+        A_SHIFT,            // consume the terminal and move to the next state
+        A_VALUE,            // value -> STRING | NUMBER | true | false | null, then goto on value
+        A_OPEN,             // push '[' or '{' and move to the next state
+        A_CLOSE,            // pop '[' or '{', reduce value -> array | object, then goto on value
+        A_ACCEPT,           // JSON -> value eof
+    } JSONParseActionType;
+
+    struct JSONParseAction
+    {
+        JSONParseActionType type;
+        JSONParseState next;
+    };
+
+    ///
+    /// The precomputed action table, indexed by parse state and terminal tag.
+    ///
+    struct JSONParseTable
+    {
+        JSONParseAction actions[P_ACCEPT + 1][JSON];
+
+        JSONParseTable()
+        {
+            for (auto & row : actions)
+                for (auto & action : row)
+                    action = {A_ERROR, P_ACCEPT};
+
+            // value -> object | array | STRING | NUMBER | "true" | "false" | "null"
+            for (JSONParseState state : {P_DOCUMENT, P_ARRAY_FIRST, P_ARRAY_VALUE, P_OBJECT_VALUE})
+            {
+                for (JSONTagType tag : {STRING, NUMBER, L_TRUE, L_FALSE, L_NULL})
+                    actions[state][tag] = {A_VALUE, P_ACCEPT};
+                actions[state][OPEN_BRACKET] = {A_OPEN, P_ARRAY_FIRST};
+                actions[state][OPEN_BRACE] = {A_OPEN, P_OBJECT_FIRST};
+            }
+            // JSON -> value eof
+            actions[P_DOCUMENT_END][eof] = {A_ACCEPT, P_ACCEPT};
+            // array -> '[' ']' | '[' values ']', values -> values ',' value | value
+            actions[P_ARRAY_FIRST][CLOSE_BRACKET] = {A_CLOSE, P_ACCEPT};
+            actions[P_ARRAY_NEXT][CLOSE_BRACKET] = {A_CLOSE, P_ACCEPT};
+            actions[P_ARRAY_NEXT][COMMA] = {A_SHIFT, P_ARRAY_VALUE};
+            // object -> '{' '}' | '{' members '}', members -> members ',' member | member
+            actions[P_OBJECT_FIRST][CLOSE_BRACE] = {A_CLOSE, P_ACCEPT};
+            actions[P_OBJECT_NEXT][CLOSE_BRACE] = {A_CLOSE, P_ACCEPT};
+            actions[P_OBJECT_NEXT][COMMA] = {A_SHIFT, P_OBJECT_MEMBER};
+            // member -> STRING ':' value
+            actions[P_OBJECT_FIRST][STRING] = {A_SHIFT, P_OBJECT_COLON};
+            actions[P_OBJECT_MEMBER][STRING] = {A_SHIFT, P_OBJECT_COLON};
+            actions[P_OBJECT_COLON][COLON] = {A_SHIFT, P_OBJECT_VALUE};
+        }
+
+        static const JSONParseTable & instance()
+        {
+            static const JSONParseTable table;
+            return table;
+        }
+    };
+}
+
+namespace libJSON
+{
+    ///
+    /// Empty callbacks to derive a handler for a BasicJSONParser from. A handler hides the
+    /// callbacks it is interested in; they are called statically and can be inlined.
+    ///
+    struct JSONHandler
+    {
+        void boolean(unsigned line, unsigned column, std::string_view text) {}
+        void endArray(unsigned line, unsigned column, std::string_view text) {}
+        void endDocument() {}
+        void endObject(unsigned line, unsigned column, std::string_view text) {}
+        void error(unsigned line, unsigned column, const std::string & text) {}
+        void memberValue(unsigned line, unsigned column, std::string_view text) {}
+        void nextElement(unsigned line, unsigned column, std::string_view text) {}
+        void null(unsigned line, unsigned column, std::string_view text) {}
+        void number(unsigned line, unsigned column, std::string_view number) {}
+        void space(unsigned line, unsigned column, std::string_view text) {}
+        void startArray(unsigned line, unsigned column, std::string_view text) {}
+        void startDocument() {}
+        void startObject(unsigned line, unsigned column, std::string_view text) {}
+        void string(unsigned line, unsigned column, std::string_view text) {}
+        void decodedString(unsigned line, unsigned column, std::string_view text) {}
+        void decodedNumber(unsigned line, unsigned column, const JSONNumber & number) {}
+    };
+
+    ///
+    /// A callback based JSON parser, which calls the handler type directly instead of through
+    /// virtual functions. The callbacks are the ones of SimpleJSONParser with zeroCopy: the text
+    /// points into the parsed std::string or the current chunk of the stream and is only valid
+    /// during the call.
+    ///
+    /// A document can also be pushed in pieces with feed() and finish(). The callbacks of a token
+    /// follow as soon as the token is complete; the tokenizer state, a partial token and the parse
+    /// stack are kept between the pieces. A parse() in between abandons the pushed document: it
+    /// ends with an error() and endDocument(), and the next feed() starts a new document.
+    ///
+    template <class Handler>
+    class BasicJSONParser
+    {
+    public:
+
+        Handler & handler;
+        bool decode;    // deliver decodedString() and decodedNumber()
+        libJSONImpl::JSONStatistics statistics; // of all parses since the last clear(), with LIBJSON_STATISTICS
+
+        BasicJSONParser(Handler & handler, bool decode = false) :
+            handler(handler),
+            decode(decode),
+            state(libJSONImpl::P_DOCUMENT),
+            parsing(true),
+            incremental(0, 0),
+            feeding(false) {}
+
+        BasicJSONParser & operator<<(const std::string & document)
+        {
+            return parse(document.data(), document.data() + document.size());
+        }
+
+        BasicJSONParser & operator<<(std::istream & document)
+        {
+            if (document.fail() || document.eof())
+            {
+                handler.error(0, 0, "empty or illegal JSON document");
+                return *this;
+            }
+
+            libJSONImpl::JSONTokenizer tokenizer(document);
+            return parse(tokenizer);
+        }
+
+        BasicJSONParser & parse(const char * begin, const char * end)
+        {
+            libJSONImpl::JSONTokenizer tokenizer(begin, end);
+            return parse(tokenizer);
+        }
+
+        BasicJSONParser & parse(libJSONImpl::JSONTokenizer & tokenizer)
+        {
+            return parse(tokenizer, 0, true);
+        }
+
+        ///
+        /// Parses a part of the elements of a top level array, as split by a ParallelJSONParser.
+        /// The callbacks are the same as for these tokens of the whole document.
+        /// @param open the '[' of the array, if the part does not start with the document but behind a ','
+        /// @param last false, if the part ends behind the ',' in front of the next element
+        ///
+        BasicJSONParser & parse(libJSONImpl::JSONTokenizer & tokenizer, const libJSONImpl::JSONFrame * open, bool last)
+        {
+            libJSONImpl::JSONToken token;
+            if (feeding)
+                abandon();
+            tokenizer.zeroCopy = true;
+            tokenizer.decode = decode;
+            tokenizer.statistics = &statistics;
+            stack.clear();
+            state = libJSONImpl::P_DOCUMENT;
+            parsing = true;
+            if (open)
+            {
+                stack.push_back(*open);
+                state = libJSONImpl::P_ARRAY_VALUE;
+            }
+
+            handler.startDocument();
+            do
+            {
+                scan(tokenizer, token);
+                consume(token, last);
+            }
+            while (token.tag != libJSONImpl::eof);
+
+            handler.endDocument();
+            return *this;
+        }
+
+        ///
+        /// Continues the pushed document with the next piece, which only has to stay valid during
+        /// the call. The first piece after construction or finish() starts a new document.
+        ///
+        BasicJSONParser & feed(const char * data, std::size_t size)
+        {
+            if (!feeding)
+                start();
+            incremental.feed(data, data + size);
+            while (scan(incremental, pending))
+                consume(pending, true);
+            return *this;
+        }
+
+        ///
+        /// Ends the pushed document, completes its last token and checks, that the document is complete.
+        ///
+        BasicJSONParser & finish()
+        {
+            if (!feeding)
+                start();
+            incremental.more = false;
+            do
+            {
+                scan(incremental, pending);
+                consume(pending, true);
+            }
+            while (pending.tag != libJSONImpl::eof);
+
+            feeding = false;
+            handler.endDocument();
+            return *this;
+        }
+
+        /// @return true, if the last parse reported a parse error; the handler's error() can already ask
+        bool failed() const { return !parsing; }
+
+    protected:
+
+        void start()
+        {
+            incremental.reset();
+            incremental.zeroCopy = true;
+            incremental.decode = decode;
+            incremental.statistics = &statistics;
+            stack.clear();
+            state = libJSONImpl::P_DOCUMENT;
+            parsing = true;
+            feeding = true;
+            handler.startDocument();
+        }
+
+        ///
+        /// Ends the pushed document, which a parse() interrupts, as a failed one.
+        ///
+        void abandon()
+        {
+            parsing = false;
+            handler.error(incremental.line, incremental.column, "unfinished pushed JSON document abandoned");
+            feeding = false;
+            handler.endDocument();
+        }
+
+        bool scan(libJSONImpl::JSONTokenizer & tokenizer, libJSONImpl::JSONToken & token)
+        {
+            libJSONImpl::JSONStopwatch stopwatch(statistics.tokenizeSeconds);
+            return tokenizer.next(token);
+        }
+
+        ///
+        /// Delivers a complete token and performs its parse action.
+        ///
+        void consume(const libJSONImpl::JSONToken & token, bool last)
+        {
+            {
+                libJSONImpl::JSONStopwatch stopwatch(statistics.callbackSeconds);
+                dispatch(token);
+            }
+
+            libJSONImpl::JSONStopwatch stopwatch(statistics.parseSeconds);
+            if (token.tag == libJSONImpl::SPACE)
+                return;
+            else if (token.tag == libJSONImpl::ERROR)
+                syntaxError(token);
+            else if (token.tag == libJSONImpl::eof && !last)
+                return;
+            else if (parsing && !shift(token))
+            {
+                parsing = false;
+                parseError(token);
+            }
+        }
+
+        void dispatch(const libJSONImpl::JSONToken & token)
+        {
+            switch (token.tag)
+            {
+                case libJSONImpl::SPACE:
+                    handler.space(token.line, token.column, token.text);
+                    break;
+                case libJSONImpl::L_NULL:
+                    handler.null(token.line, token.column, token.text);
+                    break;
+                case libJSONImpl::L_TRUE:
+                case libJSONImpl::L_FALSE:
+                    handler.boolean(token.line, token.column, token.text);
+                    break;
+                case libJSONImpl::OPEN_BRACE:
+                    handler.startObject(token.line, token.column, token.text);
+                    break;
+                case libJSONImpl::CLOSE_BRACE:
+                    handler.endObject(token.line, token.column, token.text);
+                    break;
+                case libJSONImpl::OPEN_BRACKET:
+                    handler.startArray(token.line, token.column, token.text);
+                    break;
+                case libJSONImpl::CLOSE_BRACKET:
+                    handler.endArray(token.line, token.column, token.text);
+                    break;
+                case libJSONImpl::STRING:
+                    handler.string(token.line, token.column, token.text);
+                    if (decode)
+                        handler.decodedString(token.line, token.column, token.unescaped);
+                    break;
+                case libJSONImpl::NUMBER:
+                    handler.number(token.line, token.column, token.text);
+                    if (decode)
+                        handler.decodedNumber(token.line, token.column, token.number);
+                    break;
+                case libJSONImpl::COMMA:
+                    handler.nextElement(token.line, token.column, token.text);
+                    break;
+                case libJSONImpl::COLON:
+                    handler.memberValue(token.line, token.column, token.text);
+                    break;
+                default:
+                    break;
+            }
+        }
+
+        void parseError(const libJSONImpl::JSONToken & token)
+        {
+            std::ostringstream msg;
+            msg << "JSON parse error at '" << token.text << "' =:: " << token.tag;
+            handler.error(token.line, token.column, msg.str());
+        }
+
+        void syntaxError(const libJSONImpl::JSONToken & token)
+        {
+            std::ostringstream msg;
+            msg << "JSON " << token.tag << " at '" << token.text << "'";
+            handler.error(token.line, token.column, msg.str());
+        }
+
+        ///
+        /// Performs the table action for the next terminal in O(1).
+        /// The stack only holds a frame for each currently open '[' and '{'.
+        /// @return false, if the terminal can not continue the document
+        ///
+        bool shift(const libJSONImpl::JSONToken & token)
+        {
+            const libJSONImpl::JSONParseAction & action = libJSONImpl::JSONParseTable::instance().actions[state][token.tag];
+            switch (action.type)
+            {
+                case libJSONImpl::A_SHIFT:
+                    statistics.shift(stack.size());
+                    state = action.next;
+                    return true;
+                case libJSONImpl::A_VALUE:
+                    statistics.reduce();
+                    state = gotoValue();
+                    return true;
+                case libJSONImpl::A_OPEN:
+                    stack.push_back(token);
+                    statistics.shift(stack.size());
+                    state = action.next;
+                    return true;
+                case libJSONImpl::A_CLOSE:
+                    stack.pop_back();
+                    statistics.reduce();
+                    state = gotoValue();
+                    return true;
+                case libJSONImpl::A_ACCEPT:
+                    statistics.reduce();
+                    state = libJSONImpl::P_ACCEPT;
+                    return true;
+                case libJSONImpl::A_ERROR:
+                    break;
+            }
+            return false;
+        }
+
+        ///
+        /// The goto on a completed value only depends on the enclosing container.
+        ///
+        libJSONImpl::JSONParseState gotoValue() const
+        {
+            if (stack.empty())
+                return libJSONImpl::P_DOCUMENT_END;
+            else if (stack.back().tag == libJSONImpl::OPEN_BRACKET)
+                return libJSONImpl::P_ARRAY_NEXT;
+            else
+                return libJSONImpl::P_OBJECT_NEXT;
+        }
+
+        std::vector<libJSONImpl::JSONFrame> stack;
+        libJSONImpl::JSONParseState state;
+        bool parsing;   // no parse error so far, the grammar is still checked
+        libJSONImpl::JSONTokenizer incremental; // the tokenizer of a pushed document
+        libJSONImpl::JSONToken pending;         // the token of a pushed document, which may be partial
+        bool feeding;   // a pushed document was started and not finished yet
+    };
+}
+
+#endif // BasicJSONParser_hxx
@@ -0,0 +1,164 @@
+//
+//  Part of libJSON, licensed under the GNU Lesser General Public License v3.
+//  Copyright © 2026 the libJSON contributors.
+//
+
+#ifndef JSONDocument_hxx
+#define JSONDocument_hxx
+
+#include <libJSON/config.hxx>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace libJSONImpl
+{
+    class JSONDocumentBuilder;
+}
+
+namespace libJSON
+{
+    struct JSONMember;
+
+    ///
+    /// A value of a JSONDocument. Values are compact tagged nodes, which live in the arena
+    /// of their document and are only valid until the document is parsed again or destroyed.
+    ///
+    struct JSONValue
+    {
+        typedef enum
+        {
+            NULL_VALUE,
+            BOOLEAN,
+            INTEGER,    // std::int64_t
+            UNSIGNED,   // std::uint64_t beyond the range of std::int64_t
+            REAL,
+            STRING,     // unescaped UTF-8, zero terminated
+            ARRAY,
+            OBJECT,
+        } Type;
+
+        Type type;
+        std::uint32_t size;     // the length of a STRING or the number of elements or members, parse() rejects more
+        union
+        {
+            bool boolean;
+            std::int64_t integer;
+            std::uint64_t unsignedInteger;
+            double real;
+            const char * text;
+            const JSONValue * elements;
+            const JSONMember * members;
+        };
+
+        bool isNull() const { return type == NULL_VALUE; }
+        bool isNumber() const { return type == INTEGER || type == UNSIGNED || type == REAL; }
+
+        std::string_view string() const { return type == STRING ? std::string_view(text, size) : std::string_view(); }
+        double number() const;
+
+        ///
+        /// @return the value of the first member named key, or 0 if there is none or this is not an OBJECT
+        ///
+        const JSONValue * find(std::string_view key) const;
+
+        ///
+        /// @throw std::out_of_range if this is not an ARRAY or index is not below size
+        ///
+        const JSONValue & operator[](std::size_t index) const;
+
+        ///
+        /// @throw std::out_of_range if this is not an OBJECT or has no member named key
+        ///
+        const JSONValue & operator[](std::string_view key) const;
+    };
+
+    struct JSONMember
+    {
+        JSONValue key;          // a STRING
+        JSONValue value;
+    };
+
+    ///
+    /// A bump allocator. Memory is only given back all at once, and reset() keeps the blocks,
+    /// so that parsing the next document does not have to fault in fresh pages.
+    ///
+    class JSONArena
+    {
+    public:
+
+        JSONArena(std::size_t blockSize = 64 * 1024);
+
+        void * allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t));
+
+        template <class T> T * allocate(std::size_t count)
+        {
+            return static_cast<T *>(allocate(count * sizeof(T), alignof(T)));
+        }
+
+        /// Forgets all allocations, but keeps the blocks for reuse.
+        void reset();
+        /// Frees all blocks.
+        void release();
+        /// The total size of all blocks.
+        std::size_t capacity() const;
+
+    private:
+
+        struct Block
+        {
+            std::unique_ptr<char[]> data;
+            std::size_t size;
+        };
+
+        std::vector<Block> blocks;
+        std::size_t current;
+        char * next;
+        char * limit;
+        std::size_t blockSize;
+    };
+
+    ///
+    /// A document tree built by the parser. All values and strings are stored in the arena
+    /// owned by the document; object keys are interned, so repeated keys are stored once.
+    /// A document can parse any number of documents one after the other and reuses its memory.
+    ///
+    class JSONDocument
+    {
+    public:
+
+        JSONDocument();
+        ~JSONDocument();
+
+        ///
+        /// Parses a document and replaces the previous values.
+        /// @throw std::runtime_error on a syntax or parse error, or a string or container beyond
+        ///        the 32 bit JSONValue::size
+        ///
+        const JSONValue & parse(const std::string & document);
+        const JSONValue & parse(const char * begin, const char * end);
+        const JSONValue & parse(std::istream & document);
+
+        const JSONValue & root() const { return value; }
+
+        /// Releases the values, but keeps the memory of the arena.
+        void clear();
+
+        JSONArena & arena() { return memory; }
+
+    private:
+
+        JSONDocument(const JSONDocument &) = delete;
+        JSONDocument & operator=(const JSONDocument &) = delete;
+
+        JSONArena memory;
+        JSONValue value;
+        std::unique_ptr<libJSONImpl::JSONDocumentBuilder> builder;
+    };
+}
+
+#endif // JSONDocument_hxx
@@ -0,0 +1,37 @@
+//
+//  Part of libJSON, licensed under the GNU Lesser General Public License v3.
+//  Copyright © 2026 the libJSON contributors.
+//
+
+#ifndef JSONScan_hxx
+#define JSONScan_hxx
+
+#include <libJSON/config.hxx>
+
+namespace libJSONImpl
+{
+    ///
+    /// Scanning kernels for the tokenizer hot loops. Each kernel returns the first position
+    /// in [begin, end) which does not continue the run. The best implementation for the
+    /// running CPU (AVX2, SSE2 or scalar) is selected once at runtime.
+    ///
+    struct JSONScanKernels
+    {
+        /// Skips (\u0009, \u000a, \u000d,  )*, counting the line feeds and remembering the last one.
+        const char * (*space)(const char * begin, const char * end, unsigned & newlines, const char * & lastNewline);
+        /// Skips string characters up to a '"', a '\\' or a control character below  .
+        const char * (*string)(const char * begin, const char * end);
+        /// Skips ['0',..,'9']*.
+        const char * (*digits)(const char * begin, const char * end);
+        /// The name of the selected implementation.
+        const char * name;
+
+        static const JSONScanKernels & instance();
+        static const JSONScanKernels & scalar();
+        /// The SSE2 and AVX2 implementations, or 0 if the build or the running CPU does not support them.
+        static const JSONScanKernels * sse2();
+        static const JSONScanKernels * avx2();
+    };
+}
+
+#endif // JSONScan_hxx
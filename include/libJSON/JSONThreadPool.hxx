@@ -0,0 +1,70 @@
+//
+//  Part of libJSON, licensed under the GNU Lesser General Public License v3.
+//  Copyright © 2026 the libJSON contributors.
+//
+
+#ifndef JSONThreadPool_hxx
+#define JSONThreadPool_hxx
+
+#include <libJSON/config.hxx>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace libJSON
+{
+    ///
+    /// A fixed number of workers, which take the submitted tasks oldest first from one queue
+    /// and sleep, while it is empty. Tasks get the index of the worker running them, e.g. to
+    /// select a thread local handler.
+    ///
+    /// A task may submit further tasks, but must not wait() for them: the worker would wait for
+    /// itself. wait() throws a std::logic_error on a worker of the pool.
+    ///
+    class JSONThreadPool
+    {
+    public:
+
+        typedef std::function<void(unsigned worker)> Task;
+
+        /// @param threads the number of workers, 0 for one per hardware thread
+        JSONThreadPool(unsigned threads = 0);
+        ~JSONThreadPool();
+
+        unsigned size() const { return static_cast<unsigned>(threads.size()); }
+
+        /// @return whether the calling thread is a worker of this pool
+        bool isWorker() const;
+
+        ///
+        /// Queues a task behind all tasks submitted before.
+        ///
+        void submit(Task task);
+
+        ///
+        /// Blocks until all submitted tasks are finished.
+        ///
+        void wait();
+
+    private:
+
+        JSONThreadPool(const JSONThreadPool &) = delete;
+        JSONThreadPool & operator=(const JSONThreadPool &) = delete;
+
+        void run(unsigned index);
+
+        std::vector<std::thread> threads;
+        std::deque<Task> tasks;             // guarded by mutex
+        std::mutex mutex;
+        std::condition_variable wakeup;     // a task was queued or the pool stops
+        std::condition_variable finished;   // the last pending task finished
+        std::size_t pending;                // tasks queued or running
+        bool stopping;
+    };
+}
+
+#endif // JSONThreadPool_hxx
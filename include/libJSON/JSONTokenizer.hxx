@@ -0,0 +1,1107 @@
+//
+//  Part of libJSON, licensed under the GNU Lesser General Public License v3.
+//  Copyright © 2026 the libJSON contributors.
+//
+
+#ifndef JSONTokenizer_hxx
+#define JSONTokenizer_hxx
+
+#include <libJSON/libJSON.hxx>
+#include <libJSON/JSONScan.hxx>
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <clocale>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// std::from_chars for double is missing from older standard libraries, e.g. libc++ before LLVM 20;
+// define LIBJSON_STRTOD to use strtod() regardless
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L && !defined(LIBJSON_STRTOD)
+#define LIBJSON_FROM_CHARS_DOUBLE
+#endif
+
+namespace libJSONImpl
+{
+    typedef enum
+    {
+        SPACE,          // (\u0009, \u000a, \u000d, \u0020)+
+        NUMBER,         // '-'?('0'|(['1',..,'9']['0',..,'9']*))('.'['0',..,'9'])?(['e','E']['+','-']?['0',..,'9']+)?
+        STRING,         // '"' [!'"']* '"'
+        L_TRUE,         // true
+        L_FALSE,        // false
+        L_NULL,         // null
+        OPEN_BRACKET,   // "["
+        CLOSE_BRACKET,  // "]"
+        OPEN_BRACE,     // "{"
+        CLOSE_BRACE,    // "}"
+        COMMA,          // ','
+        COLON,          // ':'
+        eof,            // EOF
+        JSON,           // value eof
+        value,          // object | array | STRING | NUMBER | "true" | "false" | "null"
+        object,         // '{' '}' | '{' members '}'
+        array,          // '[' ']' | '[' values ']'
+        members,        // members ',' member | member
+        member,         // STRING ':' value
+        values,         // values ',' value | value
+        ERROR,
+    } JSONTagType;
+    
+    inline std::ostream & operator<<(std::ostream & stream, const JSONTagType & tag)
+    {
+        switch (tag)
+        {
+            case SPACE:
+                return stream << "SPACE";
+            case NUMBER:
+                return stream << "NUMBER";
+            case STRING:
+                return stream << "STRING";
+            case L_TRUE:
+                return stream << "true";
+            case L_FALSE:
+                return stream << "false";
+            case L_NULL:
+                return stream << "null";
+            case OPEN_BRACKET:
+                return stream << "[";
+            case CLOSE_BRACKET:
+                return stream << "]";
+            case OPEN_BRACE:
+                return stream << "{";
+            case CLOSE_BRACE:
+                return stream << "}";
+            case COMMA:
+                return stream << ",";
+            case COLON:
+                return stream << ":";
+            case eof:
+                return stream << "EOF";
+            case JSON:
+                return stream << "JSON";
+            case value:
+                return stream << "value";
+            case object:
+                return stream << "object";
+            case array:
+                return stream << "array";
+            case members:
+                return stream << "members";
+            case member:
+                return stream << "member";
+            case values:
+                return stream << "values";
+            case ERROR:
+                return stream << "syntax error";
+        }
+        return stream;
+    }
+    
+    struct JSONToken
+    {
+        JSONTagType tag;
+        std::string value;      // the token text, if it had to be copied
+        std::string_view text;  // the token text, either in the input block or in value
+        std::string decoded;        // the unescaped STRING, if it had to be copied
+        std::string_view unescaped; // the unescaped STRING without quotes, either in the input block or in decoded
+        libJSON::JSONNumber number; // the decoded NUMBER
+        unsigned line;
+        unsigned column;
+
+        JSONToken() : tag(eof), line(0), column(0) {}
+        JSONToken(JSONTagType tag) : tag(tag), line(0), column(0) {}
+
+        void clear()
+        {
+            tag = eof;
+            line = 0;
+            column = 0;
+            if (!value.empty())
+                value.clear();
+            text = std::string_view();
+            if (!decoded.empty())
+                decoded.clear();
+            unescaped = std::string_view();
+        }
+    };
+    
+    inline std::ostream & operator<<(std::ostream & stream, const JSONToken & token)
+    {
+        return stream << "(" << token.line << "," << token.column << ") " << token.tag << ": " << token.text;
+    }
+
+    ///
+    /// Counters of the tokenizer and the parser. They are only collected, if libJSON is configured
+    /// with LIBJSON_STATISTICS, and otherwise compiled out and stay 0. The counters add up over
+    /// all parses, until they are cleared.
+    ///
+    struct JSONStatistics
+    {
+        std::uint64_t bytes;                // scanned by the tokenizer
+        std::uint64_t tokens[ERROR + 1];    // per tag
+        std::uint64_t shifts;               // terminals, that only changed the state or opened a container
+        std::uint64_t reductions;           // completed values, arrays, objects and documents
+        std::size_t maxDepth;               // of the parse stack
+        double tokenizeSeconds;
+        double callbackSeconds;
+        double parseSeconds;
+
+#ifdef LIBJSON_STATISTICS
+        static constexpr bool enabled = true;
+#else
+        static constexpr bool enabled = false;
+#endif
+
+        JSONStatistics()
+        {
+            clear();
+        }
+
+        void clear()
+        {
+            bytes = 0;
+            std::fill(tokens, tokens + ERROR + 1, 0);
+            shifts = 0;
+            reductions = 0;
+            maxDepth = 0;
+            tokenizeSeconds = 0;
+            callbackSeconds = 0;
+            parseSeconds = 0;
+        }
+
+        void scanned(const JSONToken & token)
+        {
+#ifdef LIBJSON_STATISTICS
+            bytes += token.text.size();
+            ++tokens[token.tag];
+#endif
+        }
+
+        void shift(std::size_t depth)
+        {
+#ifdef LIBJSON_STATISTICS
+            ++shifts;
+            maxDepth = std::max(maxDepth, depth);
+#endif
+        }
+
+        void reduce()
+        {
+#ifdef LIBJSON_STATISTICS
+            ++reductions;
+#endif
+        }
+
+        JSONStatistics & operator+=(const JSONStatistics & other)
+        {
+            bytes += other.bytes;
+            for (int tag = 0; tag <= ERROR; ++tag)
+                tokens[tag] += other.tokens[tag];
+            shifts += other.shifts;
+            reductions += other.reductions;
+            maxDepth = std::max(maxDepth, other.maxDepth);
+            tokenizeSeconds += other.tokenizeSeconds;
+            callbackSeconds += other.callbackSeconds;
+            parseSeconds += other.parseSeconds;
+            return *this;
+        }
+    };
+
+    inline std::ostream & operator<<(std::ostream & stream, const JSONStatistics & statistics)
+    {
+        if (!JSONStatistics::enabled)
+            return stream << "no statistics, libJSON is not configured with LIBJSON_STATISTICS" << std::endl;
+        stream << "bytes: " << statistics.bytes << std::endl << "tokens:";
+        for (int tag = 0; tag <= ERROR; ++tag)
+            if (statistics.tokens[tag])
+                stream << " " << static_cast<JSONTagType>(tag) << " " << statistics.tokens[tag];
+        return stream << std::endl
+                      << "shifts: " << statistics.shifts << ", reductions: " << statistics.reductions
+                      << ", max depth: " << statistics.maxDepth << std::endl
+                      << "seconds tokenize: " << statistics.tokenizeSeconds << ", callbacks: " << statistics.callbackSeconds
+                      << ", parse: " << statistics.parseSeconds << std::endl;
+    }
+
+    ///
+    /// Adds the time of its scope to a phase of the JSONStatistics, if they are collected.
+    ///
+    struct JSONStopwatch
+    {
+#ifdef LIBJSON_STATISTICS
+        double & seconds;
+        std::chrono::steady_clock::time_point start;
+
+        JSONStopwatch(double & seconds) : seconds(seconds), start(std::chrono::steady_clock::now()) {}
+        ~JSONStopwatch() { seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count(); }
+#else
+        JSONStopwatch(double & seconds) {}
+#endif
+    };
+
+    ///
+    /// Unescapes a STRING token while it is scanned. Runs without escapes are left in the input
+    /// block and only copied, if the string contains an escape or crosses a block boundary.
+    ///
+    struct JSONStringDecoder
+    {
+        const char * plain;     // start of the pending run without escapes, or 0
+        bool copied;            // the string is collected in JSONToken::decoded
+        unsigned codeUnit;      // the \uXXXX being scanned
+        unsigned highSurrogate; // a high surrogate waiting for its low surrogate, or 0
+
+        JSONStringDecoder() : plain(0), copied(false), codeUnit(0), highSurrogate(0) {}
+
+        static void appendUTF8(std::string & text, unsigned codePoint)
+        {
+            if (codePoint < 0x80)
+                text.push_back(static_cast<char>(codePoint));
+            else if (codePoint < 0x800)
+            {
+                text.push_back(static_cast<char>(0xC0 | (codePoint >> 6)));
+                text.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+            }
+            else if (codePoint < 0x10000)
+            {
+                text.push_back(static_cast<char>(0xE0 | (codePoint >> 12)));
+                text.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+                text.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+            }
+            else
+            {
+                text.push_back(static_cast<char>(0xF0 | (codePoint >> 18)));
+                text.push_back(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F)));
+                text.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+                text.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+            }
+        }
+
+        /// A high surrogate, that is not followed by a low surrogate, becomes U+FFFD.
+        void unpaired(JSONToken & token)
+        {
+            if (highSurrogate)
+            {
+                appendUTF8(token.decoded, 0xFFFD);
+                highSurrogate = 0;
+            }
+        }
+
+        /// Copies the pending run in front of an escape, a block boundary or the closing quote.
+        void flush(JSONToken & token, const char * cursor)
+        {
+            if (plain != cursor)
+            {
+                unpaired(token);
+                token.decoded.append(plain, cursor);
+            }
+            copied = true;
+        }
+
+        void escape(JSONToken & token, int c)
+        {
+            unpaired(token);
+            switch (c)
+            {
+                case 'b': token.decoded.push_back('\b'); break;
+                case 'f': token.decoded.push_back('\f'); break;
+                case 'n': token.decoded.push_back('\n'); break;
+                case 'r': token.decoded.push_back('\r'); break;
+                case 't': token.decoded.push_back('\t'); break;
+                default: token.decoded.push_back(static_cast<char>(c)); break;
+            }
+        }
+
+        void hex(int c)
+        {
+            codeUnit = (codeUnit << 4) | (c <= '9' ? c - '0' : (c | 0x20) - 'a' + 10);
+        }
+
+        void unicode(JSONToken & token)
+        {
+            if (codeUnit >= 0xD800 && codeUnit < 0xDC00)
+            {
+                unpaired(token);
+                highSurrogate = codeUnit;
+            }
+            else if (codeUnit >= 0xDC00 && codeUnit < 0xE000)
+            {
+                appendUTF8(token.decoded, highSurrogate ? 0x10000 + ((highSurrogate - 0xD800) << 10) + (codeUnit - 0xDC00) : 0xFFFD);
+                highSurrogate = 0;
+            }
+            else
+            {
+                unpaired(token);
+                appendUTF8(token.decoded, codeUnit);
+            }
+            codeUnit = 0;
+        }
+
+        void finish(JSONToken & token, const char * quote)
+        {
+            if (copied)
+            {
+                flush(token, quote);
+                unpaired(token);
+                token.unescaped = token.decoded;
+            }
+            else
+                token.unescaped = std::string_view(plain, quote - plain);
+        }
+    };
+
+    ///
+    /// Accumulates the digits of a NUMBER token while it is scanned and converts it afterwards.
+    /// Up to 19 significant digits are kept; exact doubles come from the mantissa, if it and the
+    /// power of ten are exactly representable (Clinger's fast path), and from parseReal() otherwise.
+    ///
+    struct JSONNumberDecoder
+    {
+        std::uint64_t mantissa;
+        int significant;        // digits in mantissa
+        int exponent;           // decimal exponent of mantissa from the fraction and the dropped integer digits
+        int explicitExponent;   // the value after 'e' or 'E'
+        bool negative;
+        bool negativeExponent;
+        bool truncated;         // significant digits were dropped
+        enum { INTEGER, FRACTION, EXPONENT } part;
+
+        JSONNumberDecoder() :
+            mantissa(0),
+            significant(0),
+            exponent(0),
+            explicitExponent(0),
+            negative(false),
+            negativeExponent(false),
+            truncated(false),
+            part(INTEGER) {}
+
+        void put(int c)
+        {
+            if (c >= '0' && c <= '9')
+            {
+                if (part == EXPONENT)
+                {
+                    if (explicitExponent < 100000)
+                        explicitExponent = explicitExponent * 10 + (c - '0');
+                }
+                else if (significant < 19)
+                {
+                    mantissa = mantissa * 10 + (c - '0');
+                    if (mantissa)
+                        ++significant;
+                    if (part == FRACTION)
+                        --exponent;
+                }
+                else
+                {
+                    truncated = true;
+                    if (part == INTEGER)
+                        ++exponent;
+                }
+            }
+            else if (c == '-')
+            {
+                if (part == INTEGER)
+                    negative = true;
+                else
+                    negativeExponent = true;
+            }
+            else if (c == '.')
+                part = FRACTION;
+            else if (c == 'e' || c == 'E')
+                part = EXPONENT;
+        }
+
+        void decode(std::string_view text, libJSON::JSONNumber & number) const
+        {
+            number.overflow = false;
+            if (part == INTEGER)
+            {
+                if (!truncated)
+                {
+                    if (!negative && mantissa <= static_cast<std::uint64_t>(INT64_MAX))
+                    {
+                        number.type = libJSON::JSONNumber::INTEGER;
+                        number.integer = static_cast<std::int64_t>(mantissa);
+                        return;
+                    }
+                    else if (!negative)
+                    {
+                        number.type = libJSON::JSONNumber::UNSIGNED;
+                        number.unsignedInteger = mantissa;
+                        return;
+                    }
+                    else if (mantissa <= static_cast<std::uint64_t>(INT64_MAX) + 1)
+                    {
+                        number.type = libJSON::JSONNumber::INTEGER;
+                        number.integer = static_cast<std::int64_t>(0 - mantissa);
+                        return;
+                    }
+                }
+                else if (!negative && significant + exponent == 20)
+                {
+                    // 20 digits may still fit into 64 bits
+                    std::from_chars_result result = std::from_chars(text.data(), text.data() + text.size(), number.unsignedInteger);
+                    if (result.ec == std::errc())
+                    {
+                        number.type = libJSON::JSONNumber::UNSIGNED;
+                        return;
+                    }
+                }
+                number.overflow = true;
+            }
+
+            static const double powers[] = {
+                1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+                1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+            };
+            int power = exponent + (negativeExponent ? -explicitExponent : explicitExponent);
+            number.type = libJSON::JSONNumber::REAL;
+            if (!truncated && mantissa <= (std::uint64_t(1) << 53) && power >= -22 && power <= 22)
+            {
+                number.real = static_cast<double>(mantissa);
+                number.real = power < 0 ? number.real / powers[-power] : number.real * powers[power];
+                if (negative)
+                    number.real = -number.real;
+            }
+            else
+                parseReal(text, power < 0, number.real);
+        }
+
+        ///
+        /// Converts the text of a number with std::from_chars, if the standard library has it for double,
+        /// and otherwise with strtod() on a zero terminated copy, in which the '.' is replaced by the
+        /// decimal point of the current C locale, as strtod() expects it.
+        ///
+        void parseReal(std::string_view text, bool tiny, double & real) const
+        {
+#ifdef LIBJSON_FROM_CHARS_DOUBLE
+            if (std::from_chars(text.data(), text.data() + text.size(), real).ec == std::errc::result_out_of_range)
+            {
+                real = tiny ? 0.0 : HUGE_VAL;
+                if (negative)
+                    real = -real;
+            }
+#else
+            char buffer[64];
+            std::string copy;
+            char * terminated = buffer;
+            if (text.size() < sizeof(buffer))
+            {
+                std::memcpy(buffer, text.data(), text.size());
+                buffer[text.size()] = 0;
+            }
+            else
+                terminated = &copy.assign(text.data(), text.size())[0];
+            char point = *std::localeconv()->decimal_point;
+            if (point != '.')
+                if (char * dot = std::strchr(terminated, '.'))
+                    *dot = point;
+            // strtod() already rounds an overflow to HUGE_VAL and an underflow to 0
+            real = std::strtod(terminated, 0);
+#endif
+        }
+    };
+
+    ///
+    /// Splits a document into tokens. The input is scanned in contiguous blocks, either the
+    /// caller's buffer or chunks read from a stream, and the hot loops over whitespace, string
+    /// characters and digits are delegated to the JSONScanKernels.
+    ///
+    /// Blocks can also be pushed with feed(). Then a token at the end of a block is suspended,
+    /// until the next block or the end of the document continues it.
+    ///
+    struct JSONTokenizer
+    {
+        typedef enum
+        {
+            S_START,
+            S_SPACE,
+            S_NUMBER_1_9,
+            S_NUMBER_0,
+            S_NUMBER_MINUS,
+            S_NUMBER_FRAC,
+            S_NUMBER_FRAC_DIGITS,
+            S_NUMBER_EXP,
+            S_NUMBER_EXP_SIGN,
+            S_NUMBER_EXP_DIGITS,
+            S_STRING,
+            S_ESCAPE,
+            S_HEX1,
+            S_HEX2,
+            S_HEX3,
+            S_HEX4,
+            S_LITERAL,
+            S_STOP
+        } JSONScanState;
+
+        std::istream * document;
+        std::vector<char> chunk;
+        const char * cursor;
+        const char * end;
+        const JSONScanKernels * kernels; // JSONScanKernels::instance(), unless a test forces another one
+        unsigned line;
+        unsigned column;
+        bool zeroCopy;  // leave the token text in the input block whenever possible
+        bool decode;    // unescape STRING and convert NUMBER tokens while scanning them
+        bool more;      // the end of the block is not the end of the document, more blocks are fed
+        bool suspended; // the token of the last next() continues in the next block
+        JSONScanState suspendedState;
+        JSONStringDecoder suspendedString;
+        JSONNumberDecoder suspendedNumber;
+        JSONStatistics * statistics; // counts the scanned tokens with LIBJSON_STATISTICS
+
+        JSONTokenizer(std::istream & document, std::size_t chunkSize = 64 * 1024) :
+            document(&document),
+            chunk(chunkSize),
+            cursor(0),
+            end(0),
+            kernels(&JSONScanKernels::instance()),
+            line(1),
+            column(1),
+            zeroCopy(false),
+            decode(false),
+            more(false),
+            suspended(false),
+            suspendedState(S_START),
+            statistics(0) {}
+
+        JSONTokenizer(const char * begin, const char * end) :
+            document(0),
+            cursor(begin),
+            end(end),
+            kernels(&JSONScanKernels::instance()),
+            line(1),
+            column(1),
+            zeroCopy(false),
+            decode(false),
+            more(false),
+            suspended(false),
+            suspendedState(S_START),
+            statistics(0) {}
+
+        ///
+        /// Starts a new document, whose blocks are fed.
+        ///
+        void reset()
+        {
+            cursor = 0;
+            end = 0;
+            line = 1;
+            column = 1;
+            more = true;
+            suspended = false;
+        }
+
+        ///
+        /// Continues the document with the next block, which must stay valid until next()
+        /// has consumed it. Set more to false, when the document ends with this block.
+        ///
+        void feed(const char * begin, const char * end)
+        {
+            cursor = begin;
+            this->end = end;
+        }
+
+        ///
+        /// Reads the next chunk from the stream: what its buffer already holds, up to the chunk
+        /// size, and waits for more input only, if it holds nothing, so a pipe or a socket is
+        /// parsed as far as it is written. Like the per character peek(), the end of the document
+        /// only sets eofbit on the stream, a read error badbit.
+        /// @return false at the end of the document
+        ///
+        bool fill()
+        {
+            if (document == 0 || !document->good())
+                return false;
+            std::istream::sentry sentry(*document, true);
+            if (!sentry)
+                return false;
+            std::streambuf & buffer = *document->rdbuf();
+            std::streamsize size = 0;
+            try
+            {
+                if (std::char_traits<char>::eq_int_type(buffer.sgetc(), std::char_traits<char>::eof()))
+                    document->setstate(std::ios::eofbit);
+                else
+                {
+                    std::streamsize available = std::max<std::streamsize>(buffer.in_avail(), 1);
+                    size = buffer.sgetn(chunk.data(), std::min<std::streamsize>(available, chunk.size()));
+                }
+            }
+            catch (...)
+            {
+                document->setstate(std::ios::badbit);
+            }
+            cursor = chunk.data();
+            end = cursor + size;
+            return cursor != end;
+        }
+        
+        ///
+        /// Scans the next token. The token is only complete, if it returns true: with more, the
+        /// end of the block suspends the token, and the next call after feed() continues it.
+        /// @return false, if the block ended before the token
+        ///
+        bool next(JSONToken & token)
+        {
+            JSONScanState state = S_START;
+            const char * mark = cursor; // start of the token text in the current block
+            const bool decoding = decode;
+            JSONStringDecoder stringDecoder;
+            JSONNumberDecoder numberDecoder;
+            if (suspended)
+            {
+                // the text and the unescaped string so far are already copied to the token
+                suspended = false;
+                state = suspendedState;
+                stringDecoder = suspendedString;
+                numberDecoder = suspendedNumber;
+                if (stringDecoder.plain)
+                    stringDecoder.plain = cursor;
+            }
+            else
+            {
+                token.clear();
+                token.line = line;
+                token.column = column;
+            }
+
+            while (state != S_STOP)
+            {
+                if (cursor == end)
+                {
+                    token.value.append(mark, cursor);
+                    if (stringDecoder.plain)
+                        stringDecoder.flush(token, cursor);
+                    if (!fill() && more)
+                    {
+                        suspended = true;
+                        suspendedState = state;
+                        suspendedString = stringDecoder;
+                        suspendedNumber = numberDecoder;
+                        return false;
+                    }
+                    mark = cursor;
+                    if (stringDecoder.plain)
+                        stringDecoder.plain = cursor;
+                }
+                if (cursor != end)
+                {
+                    // skip the remainder of a run in one go, the run can not contain line feeds except for S_SPACE
+                    if (state == S_SPACE && isSpace(*cursor))
+                    {
+                        unsigned newlines = 0;
+                        const char * lastNewline = 0;
+                        const char * stop = kernels->space(cursor, end, newlines, lastNewline);
+                        if (newlines)
+                        {
+                            line += newlines;
+                            column = static_cast<unsigned>(stop - lastNewline);
+                        }
+                        else
+                            column += static_cast<unsigned>(stop - cursor);
+                        cursor = stop;
+                    }
+                    else if (state == S_STRING)
+                    {
+                        const char * stop = kernels->string(cursor, end);
+                        // a two character escape within the block continues the run
+                        while (end - stop >= 2 && *stop == '\\' && isShortEscape(stop[1]))
+                        {
+                            if (decoding)
+                            {
+                                stringDecoder.flush(token, stop);
+                                stringDecoder.escape(token, stop[1]);
+                                stringDecoder.plain = stop + 2;
+                            }
+                            stop = kernels->string(stop + 2, end);
+                        }
+                        column += static_cast<unsigned>(stop - cursor);
+                        cursor = stop;
+                    }
+                    else if ((state == S_NUMBER_1_9 || state == S_NUMBER_FRAC_DIGITS || state == S_NUMBER_EXP_DIGITS)
+                             && *cursor >= '0' && *cursor <= '9')
+                    {
+                        const char * stop = kernels->digits(cursor, end);
+                        column += static_cast<unsigned>(stop - cursor);
+                        if (decoding)
+                            for (; cursor != stop; ++cursor)
+                                numberDecoder.put(*cursor);
+                        cursor = stop;
+                    }
+                    if (cursor == end)
+                        continue;
+                }
+                int c = cursor != end ? static_cast<unsigned char>(*cursor) : EOF;
+                switch (state)
+                {
+                    case S_START:
+                        if (c == ' ' || c == '\u000a' || c == '\u000d' || c == '\u0009')
+                        {
+                            token.tag = SPACE;
+                            state = S_SPACE;
+                        }
+                        else if (c == '[')
+                        {
+                            token.tag = OPEN_BRACKET;
+                            state = S_STOP;
+                        }
+                        else if (c == ']')
+                        {
+                            token.tag = CLOSE_BRACKET;
+                            state = S_STOP;
+                        }
+                        else if (c == '{')
+                        {
+                            token.tag = OPEN_BRACE;
+                            state = S_STOP;
+                        }
+                        else if (c == '}')
+                        {
+                            token.tag = CLOSE_BRACE;
+                            state = S_STOP;
+                        }
+                        else if (c == ',')
+                        {
+                            token.tag = COMMA;
+                            state = S_STOP;
+                        }
+                        else if (c == ':')
+                        {
+                            token.tag = COLON;
+                            state = S_STOP;
+                        }
+                        else if (c == '-')
+                        {
+                            token.tag = NUMBER;
+                            state = S_NUMBER_MINUS;
+                        }
+                        else if (c == '0')
+                        {
+                            token.tag = NUMBER;
+                            state = S_NUMBER_0;
+                        }
+                        else if (c >= '1' && c <= '9')
+                        {
+                            token.tag = NUMBER;
+                            state = S_NUMBER_1_9;
+                        }
+                        else if (c == '"')
+                        {
+                            token.tag = STRING;
+                            state = S_STRING;
+                            if (decoding)
+                                stringDecoder.plain = cursor + 1;
+                        }
+                        else if (c == EOF)
+                        {
+                            state = S_STOP;
+                        }
+                        else
+                        {
+                            token.tag = ERROR;
+                            state = S_LITERAL;
+                        }
+                        break; // S_START
+                    case S_SPACE:
+                        if (! (c == ' ' || c == '\u000a' || c == '\u000d' || c == '\u0009'))
+                        {
+                            state = S_STOP;
+                            c = EOF;
+                        }
+                        break; // S_SPACE
+                    case S_NUMBER_MINUS:
+                        if (c == '0')
+                        {
+                            state = S_NUMBER_0;
+                        }
+                        else if (c >= '1' && c <= '9')
+                        {
+                            state = S_NUMBER_1_9;
+                        }
+                        else
+                        {
+                            token.tag = ERROR;
+                            state = S_STOP;
+                            c = EOF;
+                        }
+                        break; // S_NUMBER_MINUS
+                    case S_NUMBER_0:
+                        if (c == '.')
+                        {
+                            state = S_NUMBER_FRAC;
+                        }
+                        else if (c == 'e' || c == 'E')
+                        {
+                            state = S_NUMBER_EXP;
+                        }
+                        else
+                        {
+                            state = S_STOP;
+                            c = EOF;
+                        }
+                        break; // S_NUMBER_0
+                    case S_NUMBER_1_9:
+                        if (c == '.')
+                        {
+                            state = S_NUMBER_FRAC;
+                        }
+                        else if (c == 'e' || c == 'E')
+                        {
+                            state = S_NUMBER_EXP;
+                        }
+                        else if (! (c >= '0' && c <= '9'))
+                        {
+                            state = S_STOP;
+                            c = EOF;
+                        }
+                        break; // S_NUMBER_1_9
+                    case S_NUMBER_FRAC:
+                        if (c >= '0' && c <= '9')
+                        {
+                            state = S_NUMBER_FRAC_DIGITS;
+                        }
+                        else
+                        {
+                            token.tag = ERROR;
+                            state = S_STOP;
+                            c = EOF;
+                        }
+                        break; // S_NUMBER_FRAC
+                    case S_NUMBER_FRAC_DIGITS:
+                        if (c == 'e' || c =='E')
+                        {
+                            state = S_NUMBER_EXP;
+                        }
+                        else if (! (c >= '0' && c <= '9'))
+                        {
+                            state = S_STOP;
+                            c = EOF;
+                        }
+                        break; // S_NUMBER_FRAC_DIGITS
+                    case S_NUMBER_EXP:
+                        if (c == '+' || c == '-')
+                        {
+                            state = S_NUMBER_EXP_SIGN;
+                        }
+                        else if (c >= '0' && c <= '9')
+                        {
+                            state = S_NUMBER_EXP_DIGITS;
+                        }
+                        else
+                        {
+                            token.tag = ERROR;
+                            state = S_STOP;
+                            c = EOF;
+                        }
+                        break; // S_NUMBER_EXP
+                    case S_NUMBER_EXP_SIGN:
+                        if (c >= '0' && c <= '9')
+                        {
+                            state = S_NUMBER_EXP_DIGITS;
+                        }
+                        else
+                        {
+                            token.tag = ERROR;
+                            state = S_STOP;
+                            c = EOF;
+                        }
+                        break; // S_NUMBER_EXP_SIGN
+                    case S_NUMBER_EXP_DIGITS:
+                        if (! (c >= '0' && c <= '9'))
+                        {
+                            state = S_STOP;
+                            c = EOF;
+                        }
+                        break; // S_NUMBER_EXP_DIGITS
+                    case S_LITERAL:
+                        if (c == ' ' || c == '\u000a' || c == '\u000d' || c == '\u0009' ||
+                            c == '[' || c == ']' ||
+                            c == '{' || c == '}' ||
+                            c == ',' || c == ':' || c == '.' || c == '"' ||
+                            c == '+' || c == '-' ||
+                            (c >= '0' && c <= '9'))
+                        {
+                            state = S_STOP;
+                            c = EOF;
+                        }
+                        if (c == EOF)
+                        {
+                            if (!token.value.empty())
+                            {
+                                token.value.append(mark, cursor);
+                                mark = cursor;
+                            }
+                            std::string_view literal = token.value.empty() ? std::string_view(mark, cursor - mark) : std::string_view(token.value);
+                            if (literal == "true")
+                                token.tag = L_TRUE;
+                            else if (literal == "false")
+                                token.tag = L_FALSE;
+                            else if (literal == "null")
+                                token.tag = L_NULL;
+                        }
+                        break; // S_LITERAL
+                    case S_STRING:
+                        if (c == '"')
+                        {
+                            state = S_STOP;
+                            if (decoding)
+                                stringDecoder.finish(token, cursor);
+                        }
+                        else if (c == '\\')
+                        {
+                            state = S_ESCAPE;
+                            if (decoding)
+                            {
+                                stringDecoder.flush(token, cursor);
+                                stringDecoder.plain = 0;
+                            }
+                        }
+                        else if (c < '\u0020')
+                        {
+                            token.tag = ERROR;
+                            state = S_STOP;
+                            c = EOF;
+                        }
+                        break; // S_STRING
+                    case S_ESCAPE:
+                        if (isShortEscape(c))
+                        {
+                            state = S_STRING;
+                            if (decoding)
+                            {
+                                stringDecoder.escape(token, c);
+                                stringDecoder.plain = cursor + 1;
+                            }
+                        }
+                        else if (c == 'u')
+                        {
+                            state = S_HEX1;
+                        }
+                        else
+                        {
+                            token.tag = ERROR;
+                            state = S_STOP;
+                            c = EOF;
+                        }
+                        break; // S_ESCAPE
+                    case S_HEX1:
+                        if ((c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F'))
+                        {
+                            state = S_HEX2;
+                            if (decoding)
+                                stringDecoder.hex(c);
+                        }
+                        else
+                        {
+                            token.tag = ERROR;
+                            state = S_STOP;
+                            c = EOF;
+                        }
+                        break; // S_HEX1
+                    case S_HEX2:
+                        if ((c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F'))
+                        {
+                            state = S_HEX3;
+                            if (decoding)
+                                stringDecoder.hex(c);
+                        }
+                        else
+                        {
+                            token.tag = ERROR;
+                            state = S_STOP;
+                            c = EOF;
+                        }
+                        break; // S_HEX2
+                    case S_HEX3:
+                        if ((c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F'))
+                        {
+                            state = S_HEX4;
+                            if (decoding)
+                                stringDecoder.hex(c);
+                        }
+                        else
+                        {
+                            token.tag = ERROR;
+                            state = S_STOP;
+                            c = EOF;
+                        }
+                        break; // S_HEX3
+                    case S_HEX4:
+                        if ((c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F'))
+                        {
+                            state = S_STRING;
+                            if (decoding)
+                            {
+                                stringDecoder.hex(c);
+                                stringDecoder.unicode(token);
+                                stringDecoder.plain = cursor + 1;
+                            }
+                        }
+                        else
+                        {
+                            token.tag = ERROR;
+                            state = S_STOP;
+                            c = EOF;
+                        }
+                        break; // S_HEX4
+                    case S_STOP:
+                        break;
+                }
+
+                if (c != EOF)
+                {
+                    if (decoding && token.tag == NUMBER)
+                        numberDecoder.put(c);
+                    ++cursor;
+                    ++column;
+                    if (c == '\u000a')
+                    {
+                        ++line;
+                        column = 1;
+                    }
+                }
+                else if (cursor == end)
+                {
+                    if (document && document->bad())
+                        token.tag = ERROR;
+                    break;
+                }
+            }
+            if (zeroCopy && token.value.empty())
+                token.text = std::string_view(mark, cursor - mark);
+            else
+            {
+                token.value.append(mark, cursor);
+                token.text = token.value;
+            }
+            if (decoding && token.tag == NUMBER)
+                numberDecoder.decode(token.text, token.number);
+#ifdef LIBJSON_STATISTICS
+            if (statistics)
+                statistics->scanned(token);
+#endif
+            return true;
+        }
+
+        static bool isSpace(char c)
+        {
+            return c == ' ' || c == '\u000a' || c == '\u000d' || c == '\u0009';
+        }
+
+        static bool isShortEscape(int c)
+        {
+            return c == '"' || c == '\\' || c == '/' || c == 'b' || c == 'f' || c == 'n' || c == 'r' || c == 't';
+        }
+    };
+}
+
+#endif // JSONTokenizer_hxx
@@ -0,0 +1,719 @@
+//
+//  Part of libJSON, licensed under the GNU Lesser General Public License v3.
+//  Copyright © 2026 the libJSON contributors.
+//
+
+#ifndef ParallelJSONParser_hxx
+#define ParallelJSONParser_hxx
+
+#include <libJSON/BasicJSONParser.hxx>
+#include <libJSON/JSONThreadPool.hxx>
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace libJSONImpl
+{
+    ///
+    /// A part of a document, which can be parsed on its own.
+    ///
+    struct JSONChunk
+    {
+        const char * begin;
+        const char * end;
+        unsigned line;      // the position of begin in the document
+        unsigned column;
+        bool first;         // starts with the document
+        bool last;          // ends with the document
+        JSONFrame array;    // the '[' of the top level array, if not first
+
+        JSONChunk() : begin(0), end(0), line(1), column(1), first(true), last(true), array(OPEN_BRACKET, 1, 1) {}
+    };
+
+    ///
+    /// Splits a top level array behind the ',' between two elements, about every chunkSize bytes.
+    /// The structural pre-pass only tracks strings and the nesting depth. Whatever it does not
+    /// understand (no array, an invalid string, the end of the array) ends the splitting, and the
+    /// rest of the document becomes the last chunk, so that errors are reported by the parser.
+    ///
+    class JSONArraySplitter
+    {
+    public:
+
+        JSONArraySplitter(const char * begin, const char * end, std::size_t chunkSize) :
+            begin(begin),
+            cursor(begin),
+            end(end),
+            lineBegin(begin),
+            chunkSize(std::max<std::size_t>(chunkSize, 1)),
+            kernels(JSONScanKernels::instance()),
+            array(OPEN_BRACKET, 1, 1),
+            line(1),
+            depth(0),
+            partBegin(begin),
+            partLine(1),
+            partColumn(1),
+            started(false),
+            splitting(true),
+            finished(false) {}
+
+        ///
+        /// @return false, if all chunks were returned
+        ///
+        bool next(JSONChunk & chunk)
+        {
+            if (finished)
+                return false;
+            if (!started)
+                start();
+
+            chunk.begin = partBegin;
+            chunk.line = partLine;
+            chunk.column = partColumn;
+            chunk.first = partBegin == begin;
+            chunk.array = array;
+
+            const char * comma = splitting ? scan() : 0;
+            if (comma)
+            {
+                chunk.end = ++cursor;
+                chunk.last = false;
+                partBegin = cursor;
+                partLine = line;
+                partColumn = static_cast<unsigned>(cursor - lineBegin) + 1;
+            }
+            else
+            {
+                chunk.end = end;
+                chunk.last = true;
+                finished = true;
+            }
+            return true;
+        }
+
+    private:
+
+        void start()
+        {
+            started = true;
+            unsigned newlines = 0;
+            const char * lastNewline = 0;
+            cursor = kernels.space(cursor, end, newlines, lastNewline);
+            if (newlines)
+            {
+                line += newlines;
+                lineBegin = lastNewline + 1;
+            }
+            if (cursor == end || *cursor != '[')
+            {
+                splitting = false;
+                return;
+            }
+            array = JSONFrame(OPEN_BRACKET, line, static_cast<unsigned>(cursor - lineBegin) + 1);
+            depth = 1;
+            ++cursor;
+        }
+
+        ///
+        /// @return the next ',' between two elements at least chunkSize behind the start of the chunk,
+        /// or 0 if there is none
+        ///
+        const char * scan()
+        {
+            while (cursor != end)
+            {
+                switch (*cursor)
+                {
+                    case '"':
+                        if (!skipString())
+                            return stop();
+                        break;
+                    case '[':
+                    case '{':
+                        ++depth;
+                        ++cursor;
+                        break;
+                    case ']':
+                    case '}':
+                        if (--depth == 0)
+                            return stop();
+                        ++cursor;
+                        break;
+                    case ',':
+                        if (depth == 1 && static_cast<std::size_t>(cursor - partBegin) >= chunkSize)
+                            return cursor;
+                        ++cursor;
+                        break;
+                    case '\n':
+                        ++line;
+                        lineBegin = ++cursor;
+                        break;
+                    default:
+                        ++cursor;
+                        break;
+                }
+            }
+            return stop();
+        }
+
+        ///
+        /// Skips a valid string, or ends the splitting where the tokenizer would report an error.
+        ///
+        bool skipString()
+        {
+            const char * p = cursor + 1;
+            for (;;)
+            {
+                p = kernels.string(p, end);
+                if (p == end)
+                    return false;
+                else if (*p == '"')
+                    break;
+                else if (*p != '\\' || end - p < 2)
+                    return false;
+                else if (p[1] && std::strchr("\"\\/bfnrt", p[1]))
+                    p += 2;
+                else if (p[1] == 'u' && end - p >= 6 && isHex(p[2]) && isHex(p[3]) && isHex(p[4]) && isHex(p[5]))
+                    p += 6;
+                else
+                    return false;
+            }
+            cursor = p + 1;
+            return true;
+        }
+
+        static bool isHex(char c)
+        {
+            return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+        }
+
+        const char * stop()
+        {
+            splitting = false;
+            return 0;
+        }
+
+        const char * begin;
+        const char * cursor;
+        const char * end;
+        const char * lineBegin;
+        std::size_t chunkSize;
+        const JSONScanKernels & kernels;
+        JSONFrame array;
+        unsigned line;
+        unsigned depth;
+        const char * partBegin;   // the start of the next chunk
+        unsigned partLine;
+        unsigned partColumn;
+        bool started;
+        bool splitting;
+        bool finished;
+    };
+
+    ///
+    /// Splits newline delimited JSON behind a line feed, about every chunkSize bytes.
+    ///
+    class JSONLineSplitter
+    {
+    public:
+
+        JSONLineSplitter(const char * begin, const char * end, std::size_t chunkSize) :
+            cursor(begin),
+            end(end),
+            chunkSize(std::max<std::size_t>(chunkSize, 1)),
+            line(1) {}
+
+        bool next(JSONChunk & chunk)
+        {
+            if (cursor == end)
+                return false;
+            const char * stop = end;
+            if (static_cast<std::size_t>(end - cursor) > chunkSize)
+            {
+                stop = static_cast<const char *>(std::memchr(cursor + chunkSize, '\n', end - cursor - chunkSize));
+                stop = stop ? stop + 1 : end;
+            }
+            chunk.begin = cursor;
+            chunk.end = stop;
+            chunk.line = line;
+            chunk.column = 1;
+            chunk.first = true;
+            chunk.last = true;
+            line += static_cast<unsigned>(std::count(cursor, stop, '\n'));
+            cursor = stop;
+            return true;
+        }
+
+    private:
+
+        const char * cursor;
+        const char * end;
+        std::size_t chunkSize;
+        unsigned line;
+    };
+
+    ///
+    /// A callback recorded by a JSONEventRecorder.
+    ///
+    struct JSONEvent
+    {
+        typedef enum
+        {
+            START_DOCUMENT,
+            END_DOCUMENT,
+            BOOLEAN,
+            END_ARRAY,
+            END_OBJECT,
+            MEMBER_VALUE,
+            NEXT_ELEMENT,
+            NULL_VALUE,
+            NUMBER,
+            SPACE,
+            START_ARRAY,
+            START_OBJECT,
+            STRING,
+            DECODED_STRING,
+            DECODED_NUMBER,
+            SYNTAX_ERROR,
+            PARSE_ERROR,
+        } Type;
+
+        Type type;
+        unsigned line;
+        unsigned column;
+        std::string_view text;
+        libJSON::JSONNumber number;
+
+        JSONEvent(Type type, unsigned line = 0, unsigned column = 0, std::string_view text = std::string_view()) :
+            type(type), line(line), column(column), text(text) {}
+    };
+
+    ///
+    /// Records the callbacks of a chunk, so they can be replayed in document order.
+    /// Texts in the document are kept as views, only errors and texts copied by the tokenizer are stored.
+    ///
+    struct JSONEventRecorder : public libJSON::JSONHandler
+    {
+        std::vector<JSONEvent> events;
+        std::deque<std::string> strings;
+        const char * documentBegin;
+        const char * documentEnd;
+        const libJSON::BasicJSONParser<JSONEventRecorder> * parser;
+        bool documents;         // record startDocument() and endDocument()
+        bool parseFailed;
+
+        JSONEventRecorder(const char * documentBegin, const char * documentEnd, bool documents) :
+            documentBegin(documentBegin),
+            documentEnd(documentEnd),
+            parser(0),
+            documents(documents),
+            parseFailed(false) {}
+
+        void boolean(unsigned line, unsigned column, std::string_view text) { events.emplace_back(JSONEvent::BOOLEAN, line, column, keep(text)); }
+        void endArray(unsigned line, unsigned column, std::string_view text) { events.emplace_back(JSONEvent::END_ARRAY, line, column, keep(text)); }
+        void endObject(unsigned line, unsigned column, std::string_view text) { events.emplace_back(JSONEvent::END_OBJECT, line, column, keep(text)); }
+        void memberValue(unsigned line, unsigned column, std::string_view text) { events.emplace_back(JSONEvent::MEMBER_VALUE, line, column, keep(text)); }
+        void nextElement(unsigned line, unsigned column, std::string_view text) { events.emplace_back(JSONEvent::NEXT_ELEMENT, line, column, keep(text)); }
+        void null(unsigned line, unsigned column, std::string_view text) { events.emplace_back(JSONEvent::NULL_VALUE, line, column, keep(text)); }
+        void number(unsigned line, unsigned column, std::string_view number) { events.emplace_back(JSONEvent::NUMBER, line, column, keep(number)); }
+        void space(unsigned line, unsigned column, std::string_view text) { events.emplace_back(JSONEvent::SPACE, line, column, keep(text)); }
+        void startArray(unsigned line, unsigned column, std::string_view text) { events.emplace_back(JSONEvent::START_ARRAY, line, column, keep(text)); }
+        void startObject(unsigned line, unsigned column, std::string_view text) { events.emplace_back(JSONEvent::START_OBJECT, line, column, keep(text)); }
+        void string(unsigned line, unsigned column, std::string_view text) { events.emplace_back(JSONEvent::STRING, line, column, keep(text)); }
+
+        void startDocument()
+        {
+            if (documents)
+                events.emplace_back(JSONEvent::START_DOCUMENT);
+        }
+
+        void endDocument()
+        {
+            if (documents)
+                events.emplace_back(JSONEvent::END_DOCUMENT);
+        }
+
+        void decodedString(unsigned line, unsigned column, std::string_view text)
+        {
+            events.emplace_back(JSONEvent::DECODED_STRING, line, column, keep(text));
+        }
+
+        void decodedNumber(unsigned line, unsigned column, const libJSON::JSONNumber & number)
+        {
+            events.emplace_back(JSONEvent::DECODED_NUMBER, line, column);
+            events.back().number = number;
+        }
+
+        void error(unsigned line, unsigned column, const std::string & text)
+        {
+            // the parser only fails at its single parse error, any other error is a syntax error
+            bool parseError = parser && parser->failed() && !parseFailed;
+            parseFailed = parseFailed || parseError;
+            strings.emplace_back(text);
+            events.emplace_back(parseError ? JSONEvent::PARSE_ERROR : JSONEvent::SYNTAX_ERROR, line, column, strings.back());
+        }
+
+        void clear()
+        {
+            events.clear();
+            strings.clear();
+            parseFailed = false;
+        }
+
+        ///
+        /// @return the text, or a copy if it is not in the document but in the token
+        ///
+        std::string_view keep(std::string_view text)
+        {
+            if (text.data() >= documentBegin && text.data() + text.size() <= documentEnd)
+                return text;
+            strings.emplace_back(text);
+            return strings.back();
+        }
+    };
+}
+
+namespace libJSON
+{
+    ///
+    /// Parses an in-memory document on the workers of a JSONThreadPool. An ARRAY document is
+    /// split between the elements of its top level array, a LINES document (NDJSON) between the
+    /// lines. Each line is parsed as a document of its own, lines with only white space are skipped.
+    ///
+    /// The callbacks are delivered either in document order to a single handler, or per chunk to
+    /// one handler per worker. The text of the callbacks points into the document and stays valid
+    /// until the document is released.
+    ///
+    /// parse() waits for the workers, so it must not run on a worker of the same pool, where it
+    /// would wait for itself; it throws a std::logic_error there.
+    ///
+    template <class Handler>
+    class ParallelJSONParser
+    {
+    public:
+
+        typedef enum
+        {
+            ARRAY,
+            LINES,
+        } Format;
+
+        JSONThreadPool & pool;
+        Format format;
+        bool decode;            // deliver decodedString() and decodedNumber()
+        std::size_t chunkSize;  // the approximate size of the parts parsed by a worker
+        libJSONImpl::JSONStatistics statistics; // the sum over all chunks, with LIBJSON_STATISTICS
+
+        ParallelJSONParser(JSONThreadPool & pool, Format format = ARRAY, bool decode = false, std::size_t chunkSize = 1024 * 1024) :
+            pool(pool),
+            format(format),
+            decode(decode),
+            chunkSize(chunkSize) {}
+
+        ///
+        /// Delivers the callbacks in document order on the calling thread. For an ARRAY they are
+        /// the same callbacks as of a BasicJSONParser, including the first parse error only.
+        /// The chunks are recorded by the workers and replayed, while the next ones are parsed.
+        ///
+        void parse(const char * begin, const char * end, Handler & handler)
+        {
+            if (format == ARRAY)
+            {
+                libJSONImpl::JSONArraySplitter splitter(begin, end, chunkSize);
+                ordered(splitter, begin, end, handler);
+            }
+            else
+            {
+                libJSONImpl::JSONLineSplitter splitter(begin, end, chunkSize);
+                ordered(splitter, begin, end, handler);
+            }
+        }
+
+        void parse(const std::string & document, Handler & handler)
+        {
+            parse(document.data(), document.data() + document.size(), handler);
+        }
+
+        ///
+        /// Delivers the callbacks of each chunk on a worker to handlers[worker], which needs no locking.
+        /// A handler sees startDocument() and endDocument() around every chunk of an ARRAY and around
+        /// every line, but the chunks in no particular order.
+        /// @param handlers at least one handler per worker of the pool
+        ///
+        void parse(const char * begin, const char * end, std::vector<Handler> & handlers)
+        {
+            if (format == ARRAY)
+            {
+                libJSONImpl::JSONArraySplitter splitter(begin, end, chunkSize);
+                unordered(splitter, handlers);
+            }
+            else
+            {
+                libJSONImpl::JSONLineSplitter splitter(begin, end, chunkSize);
+                unordered(splitter, handlers);
+            }
+        }
+
+        void parse(const std::string & document, std::vector<Handler> & handlers)
+        {
+            parse(document.data(), document.data() + document.size(), handlers);
+        }
+
+    protected:
+
+        ///
+        /// The chunks in flight, the mutex guards done and failure.
+        ///
+        struct Part
+        {
+            libJSONImpl::JSONChunk chunk;
+            std::unique_ptr<libJSONImpl::JSONEventRecorder> recorder;
+            bool done;
+        };
+
+        template <class Parser>
+        void parseChunk(Parser & parser, const libJSONImpl::JSONChunk & chunk) const
+        {
+            if (format == ARRAY)
+            {
+                libJSONImpl::JSONTokenizer tokenizer(chunk.begin, chunk.end);
+                tokenizer.line = chunk.line;
+                tokenizer.column = chunk.column;
+                parser.parse(tokenizer, chunk.first ? 0 : &chunk.array, chunk.last);
+                return;
+            }
+
+            const libJSONImpl::JSONScanKernels & kernels = libJSONImpl::JSONScanKernels::instance();
+            unsigned line = chunk.line;
+            for (const char * begin = chunk.begin; begin != chunk.end; ++line)
+            {
+                const char * end = static_cast<const char *>(std::memchr(begin, '\n', chunk.end - begin));
+                end = end ? end : chunk.end;
+                unsigned newlines = 0;
+                const char * lastNewline = 0;
+                if (kernels.space(begin, end, newlines, lastNewline) != end)
+                {
+                    libJSONImpl::JSONTokenizer tokenizer(begin, end);
+                    tokenizer.line = line;
+                    parser.parse(tokenizer);
+                }
+                begin = end != chunk.end ? end + 1 : end;
+            }
+        }
+
+        void checkThread() const
+        {
+            if (pool.isWorker())
+                throw std::logic_error("ParallelJSONParser can not parse on a worker of its own pool");
+        }
+
+        template <class Splitter>
+        void ordered(Splitter & splitter, const char * begin, const char * end, Handler & handler)
+        {
+            std::deque<std::unique_ptr<Part> > parts;
+            std::vector<std::unique_ptr<Part> > spare;  // replayed parts, which keep the capacity of their recorder
+            std::mutex mutex;
+            std::condition_variable finished;
+            std::exception_ptr failure;
+            const std::size_t window = 2 * pool.size() + 2;
+            bool splitting = true;
+            bool parseFailed = false;
+
+            checkThread();
+
+            if (format == ARRAY)
+                handler.startDocument();
+            try
+            {
+                while (splitting || !parts.empty())
+                {
+                    // keep the workers busy, but bound the recorded events
+                    while (splitting && parts.size() < window)
+                    {
+                        std::unique_ptr<Part> part;
+                        if (spare.empty())
+                        {
+                            part.reset(new Part());
+                            part->recorder.reset(new libJSONImpl::JSONEventRecorder(begin, end, format == LINES));
+                        }
+                        else
+                        {
+                            part = std::move(spare.back());
+                            spare.pop_back();
+                        }
+                        if (!(splitting = splitter.next(part->chunk)))
+                            break;
+                        part->done = false;
+                        Part * task = part.get();
+                        parts.push_back(std::move(part));
+                        pool.submit([this, task, &mutex, &finished, &failure](unsigned worker)
+                        {
+                            try
+                            {
+                                libJSON::BasicJSONParser<libJSONImpl::JSONEventRecorder> parser(*task->recorder, decode);
+                                task->recorder->parser = &parser;
+                                parseChunk(parser, task->chunk);
+                                task->recorder->parser = 0;
+                                std::lock_guard<std::mutex> lock(mutex);
+                                statistics += parser.statistics;
+                            }
+                            catch (...)
+                            {
+                                std::lock_guard<std::mutex> lock(mutex);
+                                if (!failure)
+                                    failure = std::current_exception();
+                            }
+                            std::lock_guard<std::mutex> lock(mutex);
+                            task->done = true;
+                            finished.notify_all();
+                        });
+                    }
+                    if (parts.empty())
+                        break;
+
+                    {
+                        std::unique_lock<std::mutex> lock(mutex);
+                        finished.wait(lock, [&parts] { return parts.front()->done; });
+                        if (failure)
+                            std::rethrow_exception(failure);
+                    }
+                    replay(*parts.front()->recorder, handler, parseFailed);
+                    parts.front()->recorder->clear();
+                    spare.push_back(std::move(parts.front()));
+                    parts.pop_front();
+                }
+            }
+            catch (...)
+            {
+                // the workers still refer to the parts in flight
+                std::unique_lock<std::mutex> lock(mutex);
+                finished.wait(lock, [&parts]
+                {
+                    return std::all_of(parts.begin(), parts.end(), [](const std::unique_ptr<Part> & part) { return part->done; });
+                });
+                throw;
+            }
+            if (format == ARRAY)
+                handler.endDocument();
+        }
+
+        void replay(const libJSONImpl::JSONEventRecorder & recorder, Handler & handler, bool & parseFailed) const
+        {
+            for (const libJSONImpl::JSONEvent & event : recorder.events)
+            {
+                switch (event.type)
+                {
+                    case libJSONImpl::JSONEvent::START_DOCUMENT:
+                        handler.startDocument();
+                        break;
+                    case libJSONImpl::JSONEvent::END_DOCUMENT:
+                        handler.endDocument();
+                        break;
+                    case libJSONImpl::JSONEvent::BOOLEAN:
+                        handler.boolean(event.line, event.column, event.text);
+                        break;
+                    case libJSONImpl::JSONEvent::END_ARRAY:
+                        handler.endArray(event.line, event.column, event.text);
+                        break;
+                    case libJSONImpl::JSONEvent::END_OBJECT:
+                        handler.endObject(event.line, event.column, event.text);
+                        break;
+                    case libJSONImpl::JSONEvent::MEMBER_VALUE:
+                        handler.memberValue(event.line, event.column, event.text);
+                        break;
+                    case libJSONImpl::JSONEvent::NEXT_ELEMENT:
+                        handler.nextElement(event.line, event.column, event.text);
+                        break;
+                    case libJSONImpl::JSONEvent::NULL_VALUE:
+                        handler.null(event.line, event.column, event.text);
+                        break;
+                    case libJSONImpl::JSONEvent::NUMBER:
+                        handler.number(event.line, event.column, event.text);
+                        break;
+                    case libJSONImpl::JSONEvent::SPACE:
+                        handler.space(event.line, event.column, event.text);
+                        break;
+                    case libJSONImpl::JSONEvent::START_ARRAY:
+                        handler.startArray(event.line, event.column, event.text);
+                        break;
+                    case libJSONImpl::JSONEvent::START_OBJECT:
+                        handler.startObject(event.line, event.column, event.text);
+                        break;
+                    case libJSONImpl::JSONEvent::STRING:
+                        handler.string(event.line, event.column, event.text);
+                        break;
+                    case libJSONImpl::JSONEvent::DECODED_STRING:
+                        handler.decodedString(event.line, event.column, event.text);
+                        break;
+                    case libJSONImpl::JSONEvent::DECODED_NUMBER:
+                        handler.decodedNumber(event.line, event.column, event.number);
+                        break;
+                    case libJSONImpl::JSONEvent::SYNTAX_ERROR:
+                        handler.error(event.line, event.column, std::string(event.text));
+                        break;
+                    case libJSONImpl::JSONEvent::PARSE_ERROR:
+                        // a single document only reports its first parse error
+                        if (format == LINES || !parseFailed)
+                            handler.error(event.line, event.column, std::string(event.text));
+                        parseFailed = true;
+                        break;
+                }
+            }
+        }
+
+        template <class Splitter>
+        void unordered(Splitter & splitter, std::vector<Handler> & handlers)
+        {
+            std::mutex mutex;
+            std::condition_variable finished;
+            std::exception_ptr failure;
+            std::size_t pending = 0;
+            libJSONImpl::JSONChunk chunk;
+
+            checkThread();
+            if (handlers.size() < pool.size())
+                throw std::invalid_argument("ParallelJSONParser needs a handler per worker");
+            while (splitter.next(chunk))
+            {
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    ++pending;
+                }
+                pool.submit([this, chunk, &handlers, &mutex, &finished, &failure, &pending](unsigned worker)
+                {
+                    try
+                    {
+                        libJSON::BasicJSONParser<Handler> parser(handlers[worker], decode);
+                        parseChunk(parser, chunk);
+                        std::lock_guard<std::mutex> lock(mutex);
+                        statistics += parser.statistics;
+                    }
+                    catch (...)
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        if (!failure)
+                            failure = std::current_exception();
+                    }
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (--pending == 0)
+                        finished.notify_all();
+                });
+            }
+
+            std::unique_lock<std::mutex> lock(mutex);
+            finished.wait(lock, [&pending] { return pending == 0; });
+            if (failure)
+                std::rethrow_exception(failure);
+        }
+    };
+}
+
+#endif // ParallelJSONParser_hxx
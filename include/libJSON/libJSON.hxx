@@ -7,19 +7,73 @@
 #define libJSON_hxx
 
 #include <libJSON/config.hxx>
+#include <cstddef>
+#include <cstdint>
 #include <sstream>
+#include <string>
+#include <string_view>
+
+namespace libJSONImpl
+{
+    struct JSONStatistics;
+}
 
 namespace libJSON
 {
+    ///
+    /// A NUMBER converted by the tokenizer.
+    ///
+    struct JSONNumber
+    {
+        typedef enum
+        {
+            INTEGER,    // fits into std::int64_t
+            UNSIGNED,   // fits into std::uint64_t only
+            REAL,       // has a fraction or an exponent, or overflows 64 bits
+        } Type;
+
+        Type type;
+        bool overflow;  // an integer beyond 64 bits, delivered as REAL
+        union
+        {
+            std::int64_t integer;
+            std::uint64_t unsignedInteger;
+            double real;
+        };
+    };
+
     ///
     /// A simple callback based JSON parser.
     ///
     struct SimpleJSONParser
     {
-        static SimpleJSONParser * Create(bool verbose = false);
+        ///
+        /// @param zeroCopy deliver the token text through the std::string_view callbacks,
+        ///        which point into the input buffer and avoid copying the token text
+        /// @param decode unescape strings and convert numbers while scanning them and
+        ///        deliver them to decodedString() and decodedNumber()
+        ///
+        static SimpleJSONParser * Create(bool verbose = false, bool zeroCopy = false, bool decode = false);
+
+        virtual ~SimpleJSONParser() {}
 
         virtual SimpleJSONParser & operator<<(const std::string & document) = 0;
         virtual SimpleJSONParser & operator<<(std::istream & document) = 0;
+
+        ///
+        /// Pushes a document in pieces, e.g. as they are read from a socket. A piece only has to
+        /// stay valid during the call; the callbacks of a token follow as soon as it is complete.
+        /// A parse with operator<< before finish() abandons the pushed document with an error().
+        ///
+        virtual SimpleJSONParser & feed(const char * data, std::size_t size) = 0;
+        /// Ends the pushed document.
+        virtual SimpleJSONParser & finish() = 0;
+
+        ///
+        /// The counters of all parses since their last clear(), which are only collected, if libJSON
+        /// is configured with LIBJSON_STATISTICS. Include <libJSON/JSONTokenizer.hxx> to read them.
+        ///
+        virtual libJSONImpl::JSONStatistics & statistics() = 0;
         
         virtual void boolean(unsigned line, unsigned column, const std::string & text) = 0;
         virtual void endArray(unsigned line, unsigned column, const std::string & text) = 0;
@@ -35,6 +89,41 @@ namespace libJSON
         virtual void startDocument() = 0;
         virtual void startObject(unsigned line, unsigned column, const std::string & text) = 0;
         virtual void string(unsigned line, unsigned column, const std::string & text) = 0;
+
+        ///
+        /// The zero-copy callbacks of a parser created with zeroCopy. The text points into the
+        /// parsed std::string or into the current chunk of the stream and is only valid during
+        /// the call. The defaults copy the text into a buffer, which is reused from token to token,
+        /// and forward to the callbacks above, so a parser, which only overrides those, gets the
+        /// same calls with and without zeroCopy.
+        ///
+        virtual void booleanView(unsigned line, unsigned column, std::string_view text) { boolean(line, column, copy(text)); }
+        virtual void endArrayView(unsigned line, unsigned column, std::string_view text) { endArray(line, column, copy(text)); }
+        virtual void endObjectView(unsigned line, unsigned column, std::string_view text) { endObject(line, column, copy(text)); }
+        virtual void memberValueView(unsigned line, unsigned column, std::string_view text) { memberValue(line, column, copy(text)); }
+        virtual void nextElementView(unsigned line, unsigned column, std::string_view text) { nextElement(line, column, copy(text)); }
+        virtual void nullView(unsigned line, unsigned column, std::string_view text) { null(line, column, copy(text)); }
+        virtual void numberView(unsigned line, unsigned column, std::string_view number) { this->number(line, column, copy(number)); }
+        virtual void spaceView(unsigned line, unsigned column, std::string_view text) { space(line, column, copy(text)); }
+        virtual void startArrayView(unsigned line, unsigned column, std::string_view text) { startArray(line, column, copy(text)); }
+        virtual void startObjectView(unsigned line, unsigned column, std::string_view text) { startObject(line, column, copy(text)); }
+        virtual void stringView(unsigned line, unsigned column, std::string_view text) { string(line, column, copy(text)); }
+
+        ///
+        /// The typed callbacks of a parser created with decode, called right after string()
+        /// and number(). The UTF-8 text is only valid during the call.
+        ///
+        virtual void decodedString(unsigned line, unsigned column, std::string_view text) {}
+        virtual void decodedNumber(unsigned line, unsigned column, const JSONNumber & number) {}
+
+    protected:
+
+        /// @return a copy of the text, which is only valid until the next call
+        const std::string & copy(std::string_view text) { return scratch.assign(text.data(), text.size()); }
+
+    private:
+
+        std::string scratch;
     };
 }
 
@@ -0,0 +1,426 @@
+//
+//  Part of libJSON, licensed under the GNU Lesser General Public License v3.
+//  Copyright © 2026 the libJSON contributors.
+//
+
+#include <libJSON/JSONDocument.hxx>
+#include <libJSON/BasicJSONParser.hxx>
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+
+// JSONValue::size holds 32 bits; a test build lowers the limit to check the rejection
+#ifndef LIBJSON_MAX_SIZE
+#define LIBJSON_MAX_SIZE std::numeric_limits<std::uint32_t>::max()
+#endif
+
+namespace libJSONImpl
+{
+    ///
+    /// Builds the values of a JSONDocument from the zero-copy and decoded callbacks.
+    /// The children of the open containers are collected on a scratch stack and copied
+    /// into one contiguous block of the arena, when the container is closed.
+    ///
+    class JSONDocumentBuilder : public libJSON::JSONHandler
+    {
+    public:
+
+        JSONDocumentBuilder() : parser(*this, true), arena(0), generation(1), keyCount(0), failed(false) {}
+
+        void build(libJSON::JSONArena & arena, libJSON::JSONValue & root, std::istream * stream, const char * begin, const char * end)
+        {
+            this->arena = &arena;
+            this->root = &root;
+            root.type = libJSON::JSONValue::NULL_VALUE;
+            root.size = 0;
+            values.clear();
+            frames.clear();
+            clearKeys();
+            failed = false;
+            message.clear();
+
+            if (stream)
+                parser << *stream;
+            else
+                parser.parse(begin, end);
+
+            if (failed)
+                throw std::runtime_error(message);
+        }
+
+        void boolean(unsigned line, unsigned column, std::string_view text)
+        {
+            libJSON::JSONValue value = scalar(libJSON::JSONValue::BOOLEAN);
+            value.boolean = text == "true";
+            add(value);
+        }
+
+        void null(unsigned line, unsigned column, std::string_view text)
+        {
+            add(scalar(libJSON::JSONValue::NULL_VALUE));
+        }
+
+        void decodedNumber(unsigned line, unsigned column, const libJSON::JSONNumber & number)
+        {
+            libJSON::JSONValue value;
+            switch (number.type)
+            {
+                case libJSON::JSONNumber::INTEGER:
+                    value = scalar(libJSON::JSONValue::INTEGER);
+                    value.integer = number.integer;
+                    break;
+                case libJSON::JSONNumber::UNSIGNED:
+                    value = scalar(libJSON::JSONValue::UNSIGNED);
+                    value.unsignedInteger = number.unsignedInteger;
+                    break;
+                case libJSON::JSONNumber::REAL:
+                    value = scalar(libJSON::JSONValue::REAL);
+                    value.real = number.real;
+                    break;
+            }
+            add(value);
+        }
+
+        void decodedString(unsigned line, unsigned column, std::string_view text)
+        {
+            if (!fits(text.size(), line, column, "string"))
+                return;
+            libJSON::JSONValue value = scalar(libJSON::JSONValue::STRING);
+            value.size = static_cast<std::uint32_t>(text.size());
+            if (!frames.empty() && frames.back().expectKey)
+            {
+                frames.back().expectKey = false;
+                value.text = intern(text);
+                values.push_back(value);
+            }
+            else
+            {
+                value.text = copy(text);
+                add(value);
+            }
+        }
+
+        void startArray(unsigned line, unsigned column, std::string_view text)
+        {
+            frames.push_back({values.size(), false, false});
+        }
+
+        void startObject(unsigned line, unsigned column, std::string_view text)
+        {
+            frames.push_back({values.size(), true, true});
+        }
+
+        void nextElement(unsigned line, unsigned column, std::string_view text)
+        {
+            if (!frames.empty() && frames.back().object)
+                frames.back().expectKey = true;
+        }
+
+        void endArray(unsigned line, unsigned column, std::string_view text)
+        {
+            // the parser reports an unbalanced ']' right after this callback
+            if (failed || frames.empty() || frames.back().object || !fits(values.size() - frames.back().start, line, column, "array"))
+                return;
+            std::size_t start = frames.back().start;
+            frames.pop_back();
+            libJSON::JSONValue value = scalar(libJSON::JSONValue::ARRAY);
+            value.size = static_cast<std::uint32_t>(values.size() - start);
+            libJSON::JSONValue * elements = arena->allocate<libJSON::JSONValue>(value.size);
+            std::copy(values.begin() + start, values.end(), elements);
+            value.elements = elements;
+            values.resize(start);
+            add(value);
+        }
+
+        void endObject(unsigned line, unsigned column, std::string_view text)
+        {
+            if (failed || frames.empty() || !frames.back().object || (values.size() - frames.back().start) % 2 ||
+                !fits((values.size() - frames.back().start) / 2, line, column, "object"))
+                return;
+            std::size_t start = frames.back().start;
+            frames.pop_back();
+            libJSON::JSONValue value = scalar(libJSON::JSONValue::OBJECT);
+            value.size = static_cast<std::uint32_t>((values.size() - start) / 2);
+            libJSON::JSONMember * members = arena->allocate<libJSON::JSONMember>(value.size);
+            for (std::uint32_t i = 0; i < value.size; ++i)
+            {
+                members[i].key = values[start + 2 * i];
+                members[i].value = values[start + 2 * i + 1];
+            }
+            value.members = members;
+            values.resize(start);
+            add(value);
+        }
+
+        void error(unsigned line, unsigned column, const std::string & text)
+        {
+            fail(line, column, text);
+        }
+
+    private:
+
+        struct Frame
+        {
+            std::size_t start;  // the first child on the values stack
+            bool object;
+            bool expectKey;     // the next STRING is a member key
+        };
+
+        ///
+        /// A slot of the key table, which is only used, if it is of the current generation.
+        ///
+        struct Key
+        {
+            const char * text;
+            std::size_t size;
+            std::size_t hash;
+            std::uint32_t generation;
+        };
+
+        static libJSON::JSONValue scalar(libJSON::JSONValue::Type type)
+        {
+            libJSON::JSONValue value;
+            value.type = type;
+            value.size = 0;
+            value.unsignedInteger = 0;
+            return value;
+        }
+
+        void add(const libJSON::JSONValue & value)
+        {
+            if (frames.empty())
+                *root = value;
+            else
+                values.push_back(value);
+        }
+
+        const char * copy(std::string_view text)
+        {
+            char * result = static_cast<char *>(arena->allocate(text.size() + 1, 1));
+            std::memcpy(result, text.data(), text.size());
+            result[text.size()] = 0;
+            return result;
+        }
+
+        ///
+        /// Looks the key up in an open addressing table. The table keeps its slots for the next
+        /// document, so interning the keys of a reused document does not allocate.
+        ///
+        const char * intern(std::string_view text)
+        {
+            if (2 * (keyCount + 1) > keys.size())
+                growKeys();
+            std::size_t hash = std::hash<std::string_view>()(text);
+            for (std::size_t i = hash & (keys.size() - 1); ; i = (i + 1) & (keys.size() - 1))
+            {
+                Key & key = keys[i];
+                if (key.generation != generation)
+                {
+                    key.text = copy(text);
+                    key.size = text.size();
+                    key.hash = hash;
+                    key.generation = generation;
+                    ++keyCount;
+                    return key.text;
+                }
+                if (key.hash == hash && key.size == text.size() && std::memcmp(key.text, text.data(), text.size()) == 0)
+                    return key.text;
+            }
+        }
+
+        void growKeys()
+        {
+            std::vector<Key> previous(std::max<std::size_t>(2 * keys.size(), 64), Key{0, 0, 0, 0});
+            previous.swap(keys);
+            for (const Key & key : previous)
+            {
+                if (key.generation != generation)
+                    continue;
+                std::size_t i = key.hash & (keys.size() - 1);
+                while (keys[i].generation == generation)
+                    i = (i + 1) & (keys.size() - 1);
+                keys[i] = key;
+            }
+        }
+
+        /// Forgets the keys of the previous document in O(1) by starting a new generation.
+        void clearKeys()
+        {
+            keyCount = 0;
+            if (++generation == 0)
+            {
+                std::fill(keys.begin(), keys.end(), Key{0, 0, 0, 0});
+                generation = 1;
+            }
+        }
+
+        ///
+        /// JSONValue::size holds 32 bits; a longer string or a larger container fails the document
+        /// instead of being truncated.
+        ///
+        bool fits(std::size_t size, unsigned line, unsigned column, const char * what)
+        {
+            if (size <= maxSize)
+                return true;
+            fail(line, column, std::string("JSON ") + what + " of " + std::to_string(size) + " exceeds the maximum size of " + std::to_string(maxSize));
+            return false;
+        }
+
+        void fail(unsigned line, unsigned column, const std::string & text)
+        {
+            if (!failed)
+            {
+                std::ostringstream msg;
+                msg << "(" << line << "," << column << ") " << text;
+                message = msg.str();
+                failed = true;
+            }
+        }
+
+        static constexpr std::size_t maxSize = LIBJSON_MAX_SIZE;
+
+        libJSON::BasicJSONParser<JSONDocumentBuilder> parser;
+        libJSON::JSONArena * arena;
+        libJSON::JSONValue * root;
+        std::vector<libJSON::JSONValue> values;
+        std::vector<Frame> frames;
+        std::vector<Key> keys;          // the interned keys of the current generation, a power of 2 slots
+        std::uint32_t generation;
+        std::size_t keyCount;
+        bool failed;
+        std::string message;
+    };
+}
+
+namespace libJSON
+{
+    double JSONValue::number() const
+    {
+        switch (type)
+        {
+            case INTEGER:
+                return static_cast<double>(integer);
+            case UNSIGNED:
+                return static_cast<double>(unsignedInteger);
+            case REAL:
+                return real;
+            default:
+                return 0;
+        }
+    }
+
+    const JSONValue * JSONValue::find(std::string_view key) const
+    {
+        if (type == OBJECT)
+            for (std::uint32_t i = 0; i < size; ++i)
+                if (members[i].key.string() == key)
+                    return &members[i].value;
+        return 0;
+    }
+
+    const JSONValue & JSONValue::operator[](std::size_t index) const
+    {
+        if (type != ARRAY || index >= size)
+            throw std::out_of_range("JSON array index out of range");
+        return elements[index];
+    }
+
+    const JSONValue & JSONValue::operator[](std::string_view key) const
+    {
+        const JSONValue * value = find(key);
+        if (value == 0)
+            throw std::out_of_range("JSON object has no member '" + std::string(key) + "'");
+        return *value;
+    }
+
+    JSONArena::JSONArena(std::size_t blockSize) :
+        current(0),
+        next(0),
+        limit(0),
+        blockSize(blockSize) {}
+
+    void * JSONArena::allocate(std::size_t size, std::size_t alignment)
+    {
+        for (;;)
+        {
+            if (next)
+            {
+                char * aligned = reinterpret_cast<char *>((reinterpret_cast<std::uintptr_t>(next) + alignment - 1) & ~(alignment - 1));
+                if (aligned <= limit && size <= static_cast<std::size_t>(limit - aligned))
+                {
+                    next = aligned + size;
+                    return aligned;
+                }
+                ++current;
+            }
+            // continue with the next kept block, or add a block large enough
+            if (current >= blocks.size())
+            {
+                Block block;
+                block.size = std::max(blockSize, size + alignment);
+                block.data.reset(new char[block.size]);
+                blocks.push_back(std::move(block));
+                current = blocks.size() - 1;
+            }
+            next = blocks[current].data.get();
+            limit = next + blocks[current].size;
+        }
+    }
+
+    void JSONArena::reset()
+    {
+        current = 0;
+        next = blocks.empty() ? 0 : blocks[0].data.get();
+        limit = blocks.empty() ? 0 : next + blocks[0].size;
+    }
+
+    void JSONArena::release()
+    {
+        blocks.clear();
+        reset();
+    }
+
+    std::size_t JSONArena::capacity() const
+    {
+        std::size_t result = 0;
+        for (const Block & block : blocks)
+            result += block.size;
+        return result;
+    }
+
+    JSONDocument::JSONDocument() : builder(new libJSONImpl::JSONDocumentBuilder())
+    {
+        clear();
+    }
+
+    JSONDocument::~JSONDocument() {}
+
+    const JSONValue & JSONDocument::parse(const std::string & document)
+    {
+        return parse(document.data(), document.data() + document.size());
+    }
+
+    const JSONValue & JSONDocument::parse(const char * begin, const char * end)
+    {
+        memory.reset();
+        builder->build(memory, value, 0, begin, end);
+        return value;
+    }
+
+    const JSONValue & JSONDocument::parse(std::istream & document)
+    {
+        memory.reset();
+        builder->build(memory, value, &document, 0, 0);
+        return value;
+    }
+
+    void JSONDocument::clear()
+    {
+        memory.reset();
+        value.type = JSONValue::NULL_VALUE;
+        value.size = 0;
+        value.unsignedInteger = 0;
+    }
+}
@@ -0,0 +1,221 @@
+//
+//  Part of libJSON, licensed under the GNU Lesser General Public License v3.
+//  Copyright © 2026 the libJSON contributors.
+//
+
+#include <libJSON/JSONScan.hxx>
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#define LIBJSON_SCAN_X86 1
+#include <immintrin.h>
+#endif
+
+namespace libJSONImpl
+{
+    namespace
+    {
+        inline bool isSpace(unsigned char c)
+        {
+            return c == ' ' || c == '\u000a' || c == '\u000d' || c == '\u0009';
+        }
+
+        const char * scalarSpace(const char * begin, const char * end, unsigned & newlines, const char * & lastNewline)
+        {
+            for (; begin != end && isSpace(*begin); ++begin)
+                if (*begin == '\u000a')
+                {
+                    ++newlines;
+                    lastNewline = begin;
+                }
+            return begin;
+        }
+
+        const char * scalarString(const char * begin, const char * end)
+        {
+            for (; begin != end; ++begin)
+            {
+                unsigned char c = *begin;
+                if (c == '"' || c == '\\' || c < ' ')
+                    break;
+            }
+            return begin;
+        }
+
+        const char * scalarDigits(const char * begin, const char * end)
+        {
+            while (begin != end && *begin >= '0' && *begin <= '9')
+                ++begin;
+            return begin;
+        }
+
+#ifdef LIBJSON_SCAN_X86
+        // The masks have one bit per byte with bit i for begin[i]; a zero stop mask means the whole block continues the run.
+
+        inline void countNewlines(const char * block, unsigned newlineMask, unsigned & newlines, const char * & lastNewline)
+        {
+            if (newlineMask)
+            {
+                newlines += __builtin_popcount(newlineMask);
+                lastNewline = block + (31 - __builtin_clz(newlineMask));
+            }
+        }
+
+        inline unsigned runMask(unsigned stopMask)
+        {
+            // the bits in front of the first stop bit
+            return stopMask ? (stopMask & -stopMask) - 1 : ~0u;
+        }
+
+        const char * sse2Space(const char * begin, const char * end, unsigned & newlines, const char * & lastNewline)
+        {
+            const __m128i space = _mm_set1_epi8(' ');
+            const __m128i lineFeed = _mm_set1_epi8('\u000a');
+            const __m128i carriageReturn = _mm_set1_epi8('\u000d');
+            const __m128i tab = _mm_set1_epi8('\u0009');
+            for (; end - begin >= 16; begin += 16)
+            {
+                __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(begin));
+                __m128i isLineFeed = _mm_cmpeq_epi8(block, lineFeed);
+                __m128i isSpace = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(block, space), isLineFeed),
+                                               _mm_or_si128(_mm_cmpeq_epi8(block, carriageReturn), _mm_cmpeq_epi8(block, tab)));
+                unsigned stopMask = ~_mm_movemask_epi8(isSpace) & 0xFFFFu;
+                countNewlines(begin, _mm_movemask_epi8(isLineFeed) & runMask(stopMask), newlines, lastNewline);
+                if (stopMask)
+                    return begin + __builtin_ctz(stopMask);
+            }
+            return scalarSpace(begin, end, newlines, lastNewline);
+        }
+
+        const char * sse2String(const char * begin, const char * end)
+        {
+            const __m128i quote = _mm_set1_epi8('"');
+            const __m128i backslash = _mm_set1_epi8('\\');
+            const __m128i control = _mm_set1_epi8('\u001f');
+            for (; end - begin >= 16; begin += 16)
+            {
+                __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(begin));
+                // unsigned block <= 0x1f
+                __m128i isControl = _mm_cmpeq_epi8(_mm_max_epu8(block, control), control);
+                __m128i isStop = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(block, quote), _mm_cmpeq_epi8(block, backslash)), isControl);
+                unsigned stopMask = _mm_movemask_epi8(isStop);
+                if (stopMask)
+                    return begin + __builtin_ctz(stopMask);
+            }
+            return scalarString(begin, end);
+        }
+
+        const char * sse2Digits(const char * begin, const char * end)
+        {
+            const __m128i zero = _mm_set1_epi8('0');
+            const __m128i nine = _mm_set1_epi8(9);
+            for (; end - begin >= 16; begin += 16)
+            {
+                __m128i block = _mm_sub_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(begin)), zero);
+                // unsigned (block - '0') <= 9
+                __m128i isDigit = _mm_cmpeq_epi8(_mm_min_epu8(block, nine), block);
+                unsigned stopMask = ~_mm_movemask_epi8(isDigit) & 0xFFFFu;
+                if (stopMask)
+                    return begin + __builtin_ctz(stopMask);
+            }
+            return scalarDigits(begin, end);
+        }
+
+        __attribute__((target("avx2")))
+        const char * avx2Space(const char * begin, const char * end, unsigned & newlines, const char * & lastNewline)
+        {
+            const __m256i space = _mm256_set1_epi8(' ');
+            const __m256i lineFeed = _mm256_set1_epi8('\u000a');
+            const __m256i carriageReturn = _mm256_set1_epi8('\u000d');
+            const __m256i tab = _mm256_set1_epi8('\u0009');
+            for (; end - begin >= 32; begin += 32)
+            {
+                __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(begin));
+                __m256i isLineFeed = _mm256_cmpeq_epi8(block, lineFeed);
+                __m256i isSpace = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(block, space), isLineFeed),
+                                                  _mm256_or_si256(_mm256_cmpeq_epi8(block, carriageReturn), _mm256_cmpeq_epi8(block, tab)));
+                unsigned stopMask = ~static_cast<unsigned>(_mm256_movemask_epi8(isSpace));
+                countNewlines(begin, static_cast<unsigned>(_mm256_movemask_epi8(isLineFeed)) & runMask(stopMask), newlines, lastNewline);
+                if (stopMask)
+                    return begin + __builtin_ctz(stopMask);
+            }
+            return sse2Space(begin, end, newlines, lastNewline);
+        }
+
+        __attribute__((target("avx2")))
+        const char * avx2String(const char * begin, const char * end)
+        {
+            const __m256i quote = _mm256_set1_epi8('"');
+            const __m256i backslash = _mm256_set1_epi8('\\');
+            const __m256i control = _mm256_set1_epi8('\u001f');
+            for (; end - begin >= 32; begin += 32)
+            {
+                __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(begin));
+                __m256i isControl = _mm256_cmpeq_epi8(_mm256_max_epu8(block, control), control);
+                __m256i isStop = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(block, quote), _mm256_cmpeq_epi8(block, backslash)), isControl);
+                unsigned stopMask = _mm256_movemask_epi8(isStop);
+                if (stopMask)
+                    return begin + __builtin_ctz(stopMask);
+            }
+            return sse2String(begin, end);
+        }
+
+        __attribute__((target("avx2")))
+        const char * avx2Digits(const char * begin, const char * end)
+        {
+            const __m256i zero = _mm256_set1_epi8('0');
+            const __m256i nine = _mm256_set1_epi8(9);
+            for (; end - begin >= 32; begin += 32)
+            {
+                __m256i block = _mm256_sub_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(begin)), zero);
+                __m256i isDigit = _mm256_cmpeq_epi8(_mm256_min_epu8(block, nine), block);
+                unsigned stopMask = ~static_cast<unsigned>(_mm256_movemask_epi8(isDigit));
+                if (stopMask)
+                    return begin + __builtin_ctz(stopMask);
+            }
+            return sse2Digits(begin, end);
+        }
+#endif // LIBJSON_SCAN_X86
+
+        JSONScanKernels select()
+        {
+            if (const JSONScanKernels * kernels = JSONScanKernels::avx2())
+                return *kernels;
+            if (const JSONScanKernels * kernels = JSONScanKernels::sse2())
+                return *kernels;
+            return JSONScanKernels::scalar();
+        }
+    }
+
+    const JSONScanKernels & JSONScanKernels::instance()
+    {
+        static const JSONScanKernels kernels = select();
+        return kernels;
+    }
+
+    const JSONScanKernels & JSONScanKernels::scalar()
+    {
+        static const JSONScanKernels kernels = {scalarSpace, scalarString, scalarDigits, "scalar"};
+        return kernels;
+    }
+
+    const JSONScanKernels * JSONScanKernels::sse2()
+    {
+#ifdef LIBJSON_SCAN_X86
+        static const JSONScanKernels kernels = {sse2Space, sse2String, sse2Digits, "sse2"};
+        return &kernels;
+#else
+        return 0;
+#endif
+    }
+
+    const JSONScanKernels * JSONScanKernels::avx2()
+    {
+#ifdef LIBJSON_SCAN_X86
+        static const JSONScanKernels kernels = {avx2Space, avx2String, avx2Digits, "avx2"};
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2") ? &kernels : 0;
+#else
+        return 0;
+#endif
+    }
+}
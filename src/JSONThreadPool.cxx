@@ -0,0 +1,85 @@
+//
+//  Part of libJSON, licensed under the GNU Lesser General Public License v3.
+//  Copyright © 2026 the libJSON contributors.
+//
+
+#include <libJSON/JSONThreadPool.hxx>
+#include <algorithm>
+#include <stdexcept>
+
+namespace
+{
+    /// The pool of the worker running on this thread, or 0 on any other thread.
+    thread_local const libJSON::JSONThreadPool * currentPool = 0;
+}
+
+namespace libJSON
+{
+    JSONThreadPool::JSONThreadPool(unsigned threads) :
+        pending(0),
+        stopping(false)
+    {
+        if (threads == 0)
+            threads = std::max(1u, std::thread::hardware_concurrency());
+        for (unsigned i = 0; i < threads; ++i)
+            this->threads.emplace_back(&JSONThreadPool::run, this, i);
+    }
+
+    JSONThreadPool::~JSONThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        wakeup.notify_all();
+        for (std::thread & thread : threads)
+            thread.join();
+    }
+
+    bool JSONThreadPool::isWorker() const
+    {
+        return currentPool == this;
+    }
+
+    void JSONThreadPool::submit(Task task)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            tasks.push_back(std::move(task));
+            ++pending;
+        }
+        wakeup.notify_one();
+    }
+
+    void JSONThreadPool::wait()
+    {
+        if (isWorker())
+            throw std::logic_error("JSONThreadPool::wait() on a worker of the pool would wait for itself");
+        std::unique_lock<std::mutex> lock(mutex);
+        finished.wait(lock, [this] { return pending == 0; });
+    }
+
+    void JSONThreadPool::run(unsigned index)
+    {
+        currentPool = this;
+        Task task;
+        for (;;)
+        {
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                wakeup.wait(lock, [this] { return !tasks.empty() || stopping; });
+                if (tasks.empty())
+                    return;
+                task = std::move(tasks.front());
+                tasks.pop_front();
+            }
+            task(index);
+            task = nullptr;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (--pending == 0)
+                    finished.notify_all();
+            }
+        }
+    }
+}
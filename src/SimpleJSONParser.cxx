@@ -7,8 +7,8 @@
 
 namespace libJSON
 {
-    SimpleJSONParser * SimpleJSONParser::Create(bool verbose)
+    SimpleJSONParser * SimpleJSONParser::Create(bool verbose, bool zeroCopy, bool decode)
     {
-        return new libJSONImpl::SimpleJSONParser(verbose);
+        return new libJSONImpl::SimpleJSONParser(verbose, zeroCopy, decode);
     }
 }
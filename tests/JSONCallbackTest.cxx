@@ -0,0 +1,120 @@
+//
+//  Part of libJSON, licensed under the GNU Lesser General Public License v3.
+//  Copyright © 2026 the libJSON contributors.
+//
+
+#include "JSONCountingAllocator.hxx"
+#include "SimpleJSONParser.hxx"
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+namespace
+{
+    ///
+    /// Only overrides the std::string callbacks, so it must get them with and without zeroCopy.
+    ///
+    class StringParser : public libJSONImpl::SimpleJSONParser
+    {
+    public:
+
+        std::string texts;
+        unsigned errors;
+
+        StringParser(bool zeroCopy) : libJSONImpl::SimpleJSONParser(false, zeroCopy), errors(0) {}
+
+        virtual void string(unsigned line, unsigned column, const std::string & text) { texts.append(text).append("|"); }
+        virtual void number(unsigned line, unsigned column, const std::string & number) { texts.append(number).append("|"); }
+        virtual void error(unsigned line, unsigned column, const std::string & text) { ++errors; }
+    };
+
+    ///
+    /// Overrides a zero-copy callback, which replaces the std::string callback with zeroCopy.
+    ///
+    class ViewParser : public StringParser
+    {
+    public:
+
+        std::string views;
+
+        ViewParser(bool zeroCopy) : StringParser(zeroCopy) {}
+
+        virtual void stringView(unsigned line, unsigned column, std::string_view text) { views.append(text).append("|"); }
+    };
+
+    ///
+    /// Only sums up the lengths, so it does not allocate itself.
+    ///
+    class LengthParser : public libJSONImpl::SimpleJSONParser
+    {
+    public:
+
+        std::size_t length;
+
+        LengthParser(bool zeroCopy) : libJSONImpl::SimpleJSONParser(false, zeroCopy), length(0) {}
+
+        virtual void string(unsigned line, unsigned column, const std::string & text) { length += text.size(); }
+        virtual void number(unsigned line, unsigned column, const std::string & number) { length += number.size(); }
+    };
+
+    int failures = 0;
+
+    void check(bool condition, const char * what)
+    {
+        if (!condition)
+        {
+            std::cerr << "failed: " << what << std::endl;
+            ++failures;
+        }
+    }
+}
+
+int main(int argc, char * args[])
+{
+    const std::string document("{\"a\": [1, -2.5e3, \"x\\\"y\"], \"b\": \"\"}");
+    const std::string expected("\"a\"|1|-2.5e3|\"x\\\"y\"|\"b\"|\"\"|");
+
+    StringParser copying(false);
+    StringParser zeroCopy(true);
+    copying << document;
+    zeroCopy << document;
+    check(copying.texts == expected, "std::string callbacks without zeroCopy");
+    check(zeroCopy.texts == expected, "std::string callbacks with zeroCopy");
+    check(!copying.errors && !zeroCopy.errors, "no errors");
+
+    ViewParser viewCopying(false);
+    ViewParser viewZeroCopy(true);
+    viewCopying << document;
+    viewZeroCopy << document;
+    check(viewCopying.views.empty() && viewCopying.texts == expected, "no zero-copy callbacks without zeroCopy");
+    check(viewZeroCopy.views == "\"a\"|\"x\\\"y\"|\"b\"|\"\"|" && viewZeroCopy.texts == "1|-2.5e3|", "overridden zero-copy callback with zeroCopy");
+
+    // a call with a string literal must not be ambiguous
+    libJSON::SimpleJSONParser & parser = copying;
+    copying.texts.clear();
+    parser.string(1, 1, "x");
+    check(copying.texts == "x|", "string() with a literal");
+
+    // the std::string callbacks get the text in a buffer, which is reused from token to token
+    const std::string longTexts("[\"a string beyond the small string buffer\", 1234567890123456789012345678901234567890, "
+                                "\"another string beyond the small string buffer\"]");
+    for (bool zeroCopy : {false, true})
+    {
+        LengthParser lengths(zeroCopy);
+        lengths << longTexts;
+        std::size_t before = libJSONTest::allocations;
+        lengths << longTexts;
+        check(libJSONTest::allocations == before && lengths.length == 2 * 128, zeroCopy ?
+              "no allocations per token for the std::string callbacks with zeroCopy" :
+              "no allocations per token for the std::string callbacks without zeroCopy");
+    }
+
+    // Create() returns an implementation, which is deleted through the interface
+    static_assert(std::has_virtual_destructor<libJSON::SimpleJSONParser>::value, "virtual destructor");
+    std::unique_ptr<libJSON::SimpleJSONParser> created(libJSON::SimpleJSONParser::Create(false, true));
+    *created << document;
+
+    return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
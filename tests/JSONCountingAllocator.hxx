@@ -0,0 +1,58 @@
+//
+//  Part of libJSON, licensed under the GNU Lesser General Public License v3.
+//  Copyright © 2026 the libJSON contributors.
+//
+
+#ifndef JSONCountingAllocator_hxx
+#define JSONCountingAllocator_hxx
+
+//
+// Replaces the global allocation functions to count the operator new calls of a test.
+// Include it in exactly one translation unit of the test.
+//
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+namespace libJSONTest
+{
+    /// The number of operator new calls of the whole program.
+    std::size_t allocations = 0;
+}
+
+// Not inlined, so GCC does not see free() on a pointer from operator new (-Wmismatched-new-delete).
+__attribute__((noinline)) void * operator new(std::size_t size)
+{
+    ++libJSONTest::allocations;
+    if (void * memory = std::malloc(size ? size : 1))
+        return memory;
+    throw std::bad_alloc();
+}
+
+__attribute__((noinline)) void * operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+__attribute__((noinline)) void operator delete(void * memory) noexcept
+{
+    std::free(memory);
+}
+
+__attribute__((noinline)) void operator delete(void * memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+__attribute__((noinline)) void operator delete[](void * memory) noexcept
+{
+    operator delete(memory);
+}
+
+__attribute__((noinline)) void operator delete[](void * memory, std::size_t) noexcept
+{
+    operator delete(memory);
+}
+
+#endif // JSONCountingAllocator_hxx
@@ -0,0 +1,236 @@
+//
+//  Part of libJSON, licensed under the GNU Lesser General Public License v3.
+//  Copyright © 2026 the libJSON contributors.
+//
+
+#include <libJSON/JSONTokenizer.hxx>
+#include <cerrno>
+#include <clocale>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+
+namespace
+{
+    void appendUTF8(std::string & text, unsigned codePoint)
+    {
+        libJSONImpl::JSONStringDecoder::appendUTF8(text, codePoint);
+    }
+
+    ///
+    /// Unescapes the text of a STRING token after the fact. Unpaired surrogates become U+FFFD.
+    ///
+    std::string unescape(std::string_view text)
+    {
+        std::string result;
+        unsigned highSurrogate = 0;
+        for (std::size_t i = 1; i + 1 < text.size(); ++i)
+        {
+            unsigned codeUnit = static_cast<unsigned char>(text[i]);
+            bool unicode = false;
+            if (text[i] == '\\')
+            {
+                char escape = text[++i];
+                if (escape == 'u')
+                {
+                    codeUnit = std::stoul(std::string(text.substr(i + 1, 4)), 0, 16);
+                    unicode = true;
+                    i += 4;
+                }
+                else
+                    codeUnit = escape == 'b' ? '\b' : escape == 'f' ? '\f' : escape == 'n' ? '\n' :
+                               escape == 'r' ? '\r' : escape == 't' ? '\t' : escape;
+            }
+            if (unicode && codeUnit >= 0xDC00 && codeUnit < 0xE000)
+            {
+                appendUTF8(result, highSurrogate ? 0x10000 + ((highSurrogate - 0xD800) << 10) + (codeUnit - 0xDC00) : 0xFFFD);
+                highSurrogate = 0;
+                continue;
+            }
+            if (highSurrogate)
+                appendUTF8(result, 0xFFFD);
+            highSurrogate = 0;
+            if (unicode && codeUnit >= 0xD800 && codeUnit < 0xDC00)
+                highSurrogate = codeUnit;
+            else if (unicode)
+                appendUTF8(result, codeUnit);
+            else
+                result.push_back(static_cast<char>(codeUnit));
+        }
+        if (highSurrogate)
+            appendUTF8(result, 0xFFFD);
+        return result;
+    }
+
+    ///
+    /// The number as strtoll(), strtoull() or strtod() in the C locale convert it.
+    ///
+    bool expected(const std::string & text, const libJSON::JSONNumber & number)
+    {
+        const char * begin = text.c_str();
+        double real = std::strtod(begin, 0);
+        if (text.find_first_of(".eE") != std::string::npos)
+            return number.type == libJSON::JSONNumber::REAL && !number.overflow &&
+                   number.real == real && std::signbit(number.real) == std::signbit(real);
+        errno = 0;
+        long long integer = std::strtoll(begin, 0, 10);
+        if (errno == 0)
+            return number.type == libJSON::JSONNumber::INTEGER && !number.overflow && number.integer == integer;
+        errno = 0;
+        unsigned long long unsignedInteger = text[0] != '-' ? std::strtoull(begin, 0, 10) : 0;
+        if (errno == 0 && text[0] != '-')
+            return number.type == libJSON::JSONNumber::UNSIGNED && !number.overflow && number.unsignedInteger == unsignedInteger;
+        return number.type == libJSON::JSONNumber::REAL && number.overflow && number.real == real;
+    }
+
+    std::string randomNumber(std::mt19937_64 & random)
+    {
+        char buffer[64];
+        switch (random() % 6)
+        {
+            case 0:
+                std::snprintf(buffer, sizeof(buffer), "%lld", static_cast<long long>(random()));
+                break;
+            case 1:
+                std::snprintf(buffer, sizeof(buffer), "%llu", static_cast<unsigned long long>(random()));
+                break;
+            case 2:
+                std::snprintf(buffer, sizeof(buffer), "%.17g", std::ldexp(static_cast<double>(random() >> 11), static_cast<int>(random() % 200) - 100));
+                break;
+            case 3:
+                // beyond the range of double in both directions
+                std::snprintf(buffer, sizeof(buffer), "-%llu.%llue%d", static_cast<unsigned long long>(random() % 1000000),
+                              static_cast<unsigned long long>(random() % 100000), static_cast<int>(random() % 700) - 350);
+                break;
+            case 4:
+                // beyond 64 bits
+                std::snprintf(buffer, sizeof(buffer), "%llu%llu", static_cast<unsigned long long>(random()), static_cast<unsigned long long>(random()));
+                break;
+            default:
+                std::snprintf(buffer, sizeof(buffer), "%d.%de%d", static_cast<int>(random() % 100), static_cast<int>(random() % 1000),
+                              static_cast<int>(random() % 40) - 20);
+                break;
+        }
+        return buffer;
+    }
+
+    const char * const pieces[] = {
+        "a", "xyz", "\\n", "\\\"", "\\\\", "\\/", "\\b", "\\f", "\\t", "\\r", "\\u0041", "\\u00e9", "\\u20AC",
+        "\\uD83D\\uDE00", "\\uD83D", "\\uDE00", "\\ud800\\u0041", "\xc3\xa9", "0123456789abcdefghijklmnopqrstuvwxyz"
+    };
+
+    ///
+    /// Decodes random arrays of strings and numbers, from a buffer and from streams with small chunks.
+    ///
+    bool check(unsigned iterations, std::size_t & strings, std::size_t & numbers)
+    {
+        std::mt19937_64 random(1);
+        for (unsigned i = 0; i < iterations; ++i)
+        {
+            std::string document("[");
+            for (unsigned n = random() % 8, value = 0; value < n; ++value)
+            {
+                if (value)
+                    document.append(",");
+                if (random() % 2)
+                {
+                    document.append("\"");
+                    for (unsigned k = random() % 6; k; --k)
+                        document.append(pieces[random() % (sizeof(pieces) / sizeof(pieces[0]))]);
+                    document.append("\"");
+                }
+                else
+                    document.append(randomNumber(random));
+            }
+            document.append("]");
+
+            std::istringstream stream(document);
+            std::unique_ptr<libJSONImpl::JSONTokenizer> tokenizer(i % 2 ?
+                new libJSONImpl::JSONTokenizer(stream, 1 + random() % 13) :
+                new libJSONImpl::JSONTokenizer(document.data(), document.data() + document.size()));
+            tokenizer->decode = true;
+            tokenizer->zeroCopy = random() % 2;
+            libJSONImpl::JSONToken token;
+            do
+            {
+                tokenizer->next(token);
+                if (token.tag == libJSONImpl::ERROR)
+                {
+                    std::cerr << "syntax error in " << document << ": " << token.text << std::endl;
+                    return false;
+                }
+                else if (token.tag == libJSONImpl::STRING && unescape(token.text) != token.unescaped)
+                {
+                    std::cerr << "string " << token.text << " decoded as [" << token.unescaped << "], expected ["
+                              << unescape(token.text) << "]" << std::endl;
+                    return false;
+                }
+                else if (token.tag == libJSONImpl::NUMBER && !expected(std::string(token.text), token.number))
+                {
+                    std::cerr << "number " << token.text << " decoded as type " << token.number.type << ", overflow " << token.number.overflow
+                              << ", " << token.number.integer << " / " << token.number.unsignedInteger << " / " << token.number.real << std::endl;
+                    return false;
+                }
+                strings += token.tag == libJSONImpl::STRING;
+                numbers += token.tag == libJSONImpl::NUMBER;
+            }
+            while (token.tag != libJSONImpl::eof);
+        }
+        return true;
+    }
+}
+
+///
+/// Checks the strings and numbers decoded while scanning against a separate unescaper and the C library
+/// conversions, in the C locale and again in a locale with a decimal comma, if one is installed.
+/// Arguments: [documents = 100000]
+///
+int main(int argc, char * args[])
+{
+    unsigned iterations = argc > 1 ? std::strtoul(args[1], 0, 10) : 100000;
+    std::size_t strings = 0, numbers = 0;
+    if (!check(iterations, strings, numbers))
+        return EXIT_FAILURE;
+#ifdef LIBJSON_FROM_CHARS_DOUBLE
+    std::cout << "std::from_chars: ";
+#else
+    std::cout << "strtod: ";
+#endif
+    std::cout << strings << " strings and " << numbers << " numbers decoded" << std::endl;
+
+    for (const char * name : {"de_DE.UTF-8", "de_DE.utf8", "fr_FR.UTF-8", "de_DE"})
+    {
+        if (!std::setlocale(LC_NUMERIC, name))
+            continue;
+        // the expected values are still converted in the C locale
+        std::size_t localeNumbers = 0;
+        std::string point = std::localeconv()->decimal_point;
+        std::setlocale(LC_NUMERIC, "C");
+        std::mt19937_64 random(2);
+        for (unsigned i = 0; i < iterations / 10; ++i)
+        {
+            std::string text = randomNumber(random);
+            std::setlocale(LC_NUMERIC, name);
+            libJSONImpl::JSONTokenizer tokenizer(text.data(), text.data() + text.size());
+            libJSONImpl::JSONToken token;
+            tokenizer.decode = true;
+            tokenizer.next(token);
+            std::setlocale(LC_NUMERIC, "C");
+            if (token.tag != libJSONImpl::NUMBER || !expected(text, token.number))
+            {
+                std::cerr << "number " << text << " decoded as " << token.number.real << " in " << name << std::endl;
+                return EXIT_FAILURE;
+            }
+            ++localeNumbers;
+        }
+        std::cout << name << " (decimal point '" << point << "'): " << localeNumbers << " numbers decoded" << std::endl;
+        break;
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,167 @@
+//
+//  Part of libJSON, licensed under the GNU Lesser General Public License v3.
+//  Copyright © 2026 the libJSON contributors.
+//
+
+#include "JSONCountingAllocator.hxx"
+#include <libJSON/JSONDocument.hxx>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+namespace
+{
+    int failures = 0;
+
+    void check(bool condition, const char * what)
+    {
+        if (!condition)
+        {
+            std::cerr << "failed: " << what << std::endl;
+            ++failures;
+        }
+    }
+
+    ///
+    /// @return the message of the std::runtime_error parse() throws, or an empty string
+    ///
+    std::string parseError(libJSON::JSONDocument & document, const std::string & text)
+    {
+        try
+        {
+            document.parse(text);
+        }
+        catch (const std::runtime_error & error)
+        {
+            return error.what();
+        }
+        return std::string();
+    }
+
+    template <class Lookup>
+    bool throwsOutOfRange(Lookup lookup)
+    {
+        try
+        {
+            lookup();
+        }
+        catch (const std::out_of_range &)
+        {
+            return true;
+        }
+        return false;
+    }
+
+    void checkLookup()
+    {
+        libJSON::JSONDocument document;
+        const libJSON::JSONValue & root = document.parse(
+            "{\"name\": \"x\", \"list\": [1, -2, 18446744073709551615, 2.5, true, null, \"s\\u00e9\"],\n"
+            " \"nested\": {\"a\": {\"b\": [[]]}}, \"name\": \"duplicate\"}");
+
+        check(root.type == libJSON::JSONValue::OBJECT && root.size == 4, "root object with 4 members");
+        check(root["name"].string() == "x", "the first member of a duplicate key");
+        check(root.members[0].key.text == root.members[3].key.text, "repeated keys are interned");
+        check(root.find("missing") == 0, "find() of a missing key");
+
+        const libJSON::JSONValue & list = root["list"];
+        check(list.type == libJSON::JSONValue::ARRAY && list.size == 7, "array with 7 elements");
+        check(list[0].type == libJSON::JSONValue::INTEGER && list[0].integer == 1, "integer element");
+        check(list[1].type == libJSON::JSONValue::INTEGER && list[1].integer == -2, "negative element");
+        check(list[2].type == libJSON::JSONValue::UNSIGNED && list[2].unsignedInteger == 18446744073709551615ull, "unsigned element");
+        check(list[3].type == libJSON::JSONValue::REAL && list[3].real == 2.5 && list[3].number() == 2.5, "real element");
+        check(list[4].type == libJSON::JSONValue::BOOLEAN && list[4].boolean, "boolean element");
+        check(list[5].isNull(), "null element");
+        check(list[6].string() == "s\xc3\xa9" && list[6].size == 3 && list[6].text[3] == 0, "unescaped, zero terminated string");
+        check(root["nested"]["a"]["b"][0].type == libJSON::JSONValue::ARRAY && root["nested"]["a"]["b"][0].size == 0, "nested empty array");
+
+        check(throwsOutOfRange([&list] { list[7]; }), "index beyond the size");
+        check(throwsOutOfRange([&list] { list["name"]; }), "key of an array");
+        check(throwsOutOfRange([&root] { root[0]; }), "index of an object");
+        check(throwsOutOfRange([&root] { root["missing"]; }), "missing key");
+
+        std::istringstream stream("[\"from\", \"a\", \"stream\"]");
+        check(document.parse(stream)[2].string() == "stream", "parse() of a stream");
+    }
+
+    void checkErrors()
+    {
+        libJSON::JSONDocument document;
+        std::string message = parseError(document, "[1, 2");
+        check(message.compare(0, 6, "(1,6) ") == 0, "an unclosed array fails at its end");
+        check(!parseError(document, "{\"a\" 1}").empty(), "a missing ':' fails");
+        check(!parseError(document, "[1,]").empty(), "a trailing ',' fails");
+        check(!parseError(document, "\"\\x\"").empty(), "an invalid escape fails");
+        check(!parseError(document, "[1] 2").empty(), "a second value fails");
+        check(document.parse("[3]")[0].integer == 3, "a document parses again after an error");
+    }
+
+    ///
+    /// A reused document keeps its arena and its key table, so parsing the same kind of
+    /// document again does not allocate.
+    ///
+    void checkReuse()
+    {
+        std::string text("{");
+        for (int i = 0; i < 200; ++i)
+            text.append(i ? ", " : "").append("\"key").append(std::to_string(i)).append("\": [").append(std::to_string(i)).append(", \"value\"]");
+        text.append("}");
+
+        libJSON::JSONDocument document;
+        document.parse(text);
+        document.parse(text);
+        std::size_t capacity = document.arena().capacity();
+        std::size_t before = libJSONTest::allocations;
+        bool found = true;
+        for (int n = 0; n < 100; ++n)
+        {
+            const libJSON::JSONValue & root = document.parse(text);
+            for (int i = 0; i < 200; i += 7)
+                found = found && root["key" + std::to_string(i)][0].integer == i;
+        }
+        check(found, "all keys of a reused document");
+        check(libJSONTest::allocations == before, "no allocations when a document is reused");
+        check(document.arena().capacity() == capacity, "the arena keeps its blocks");
+
+        // the keys of the previous document must not be found in the next one
+        const libJSON::JSONValue & root = document.parse("{\"key1\": 1, \"other\": 2, \"key1\": 3}");
+        check(root.size == 3 && root["other"].integer == 2 && root.members[0].key.text == root.members[2].key.text &&
+              root.members[0].key.text != root.members[1].key.text, "the keys of the next document");
+
+        document.clear();
+        check(document.root().isNull() && document.arena().capacity() == capacity, "clear() keeps the arena");
+        document.arena().release();
+        check(document.arena().capacity() == 0 && document.parse("{\"a\": [1]}")["a"][0].integer == 1, "parse() after release()");
+    }
+
+    ///
+    /// Built with LIBJSON_MAX_SIZE 3 instead of the 32 bit JSONValue::size.
+    ///
+    void checkMaxSize()
+    {
+        libJSON::JSONDocument document;
+        check(document.parse("[1, 2, 3]").size == 3, "an array of the maximum size");
+        check(document.parse("\"abc\"").size == 3, "a string of the maximum size");
+        check(document.parse("{\"a\": 1, \"b\": 2, \"c\": 3}").size == 3, "an object of the maximum size");
+        check(parseError(document, "[1, 2, 3, 4]") == "(1,12) JSON array of 4 exceeds the maximum size of 3", "a larger array fails");
+        check(parseError(document, "[\"abcd\"]") == "(1,2) JSON string of 4 exceeds the maximum size of 3", "a longer string fails");
+        check(parseError(document, "{\"a\": 1, \"b\": 2, \"c\": 3, \"d\": 4}") == "(1,32) JSON object of 4 exceeds the maximum size of 3",
+              "a larger object fails");
+        check(document.parse("[[1, 2, 3], [4]]").size == 2, "a document parses again after a size error");
+    }
+}
+
+int main(int argc, char * args[])
+{
+#ifdef LIBJSON_MAX_SIZE
+    checkMaxSize();
+#else
+    checkLookup();
+    checkErrors();
+    checkReuse();
+#endif
+    return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
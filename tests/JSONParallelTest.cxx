@@ -0,0 +1,241 @@
+//
+//  Part of libJSON, licensed under the GNU Lesser General Public License v3.
+//  Copyright © 2026 the libJSON contributors.
+//
+
+#include "JSONTestSupport.hxx"
+#include <libJSON/ParallelJSONParser.hxx>
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+    typedef libJSON::ParallelJSONParser<libJSONTest::JSONRecorder> ParallelParser;
+
+    const std::size_t chunkSizes[] = {1, 2, 7, 64, 4096};
+
+    std::size_t checks = 0;
+
+    std::string serialArray(const std::string & document, bool decode)
+    {
+        libJSONTest::JSONRecorder recorder;
+        libJSON::BasicJSONParser<libJSONTest::JSONRecorder> parser(recorder, decode);
+        parser << document;
+        return recorder.events;
+    }
+
+    ///
+    /// Every line with more than white space as a document of its own.
+    ///
+    std::vector<std::string> serialLines(const std::string & document, bool decode)
+    {
+        std::vector<std::string> lines;
+        unsigned line = 1;
+        for (std::size_t begin = 0; begin < document.size(); ++line)
+        {
+            std::size_t end = std::min(document.find('\n', begin), document.size());
+            if (document.find_first_not_of(" \t\r", begin) < end)
+            {
+                libJSONTest::JSONRecorder recorder;
+                libJSON::BasicJSONParser<libJSONTest::JSONRecorder> parser(recorder, decode);
+                libJSONImpl::JSONTokenizer tokenizer(document.data() + begin, document.data() + end);
+                tokenizer.line = line;
+                parser.parse(tokenizer);
+                lines.push_back(recorder.events);
+            }
+            begin = end + 1;
+        }
+        return lines;
+    }
+
+    ///
+    /// Splits the events of per worker handlers into their documents.
+    ///
+    void appendDocuments(const std::string & events, std::vector<std::string> & documents)
+    {
+        static const std::string endDocument("endDocument\n");
+        for (std::size_t begin = 0, end; (end = events.find(endDocument, begin)) != std::string::npos; begin = end)
+        {
+            end += endDocument.size();
+            documents.push_back(events.substr(begin, end - begin));
+        }
+    }
+
+    bool fail(const char * format, std::size_t chunkSize, bool decode, const std::string & document,
+              const std::string & expected, const std::string & got)
+    {
+        std::cerr << format << " with chunk size " << chunkSize << (decode ? " and decode" : "") << " differs on ["
+                  << document << "]" << std::endl << "expected:" << std::endl << expected << "got:" << std::endl << got;
+        return false;
+    }
+
+    bool checkArray(libJSON::JSONThreadPool & pool, const std::string & document)
+    {
+        for (bool decode : {false, true})
+        {
+            std::string expected = serialArray(document, decode);
+            for (std::size_t chunkSize : chunkSizes)
+            {
+                libJSONTest::JSONRecorder recorder;
+                ParallelParser parser(pool, ParallelParser::ARRAY, decode, chunkSize);
+                parser.parse(document, recorder);
+                ++checks;
+                if (recorder.events != expected)
+                    return fail("ARRAY", chunkSize, decode, document, expected, recorder.events);
+            }
+        }
+        return true;
+    }
+
+    bool checkLines(libJSON::JSONThreadPool & pool, const std::string & document)
+    {
+        for (bool decode : {false, true})
+        {
+            std::vector<std::string> lines = serialLines(document, decode);
+            std::string expected;
+            for (const std::string & line : lines)
+                expected.append(line);
+            std::sort(lines.begin(), lines.end());
+            for (std::size_t chunkSize : chunkSizes)
+            {
+                libJSONTest::JSONRecorder recorder;
+                ParallelParser parser(pool, ParallelParser::LINES, decode, chunkSize);
+                parser.parse(document, recorder);
+                ++checks;
+                if (recorder.events != expected)
+                    return fail("LINES", chunkSize, decode, document, expected, recorder.events);
+
+                // per worker handlers get the same lines in no particular order
+                std::vector<libJSONTest::JSONRecorder> recorders(pool.size());
+                parser.parse(document, recorders);
+                std::vector<std::string> documents;
+                for (const libJSONTest::JSONRecorder & worker : recorders)
+                    appendDocuments(worker.events, documents);
+                std::sort(documents.begin(), documents.end());
+                ++checks;
+                if (documents != lines)
+                {
+                    std::string got;
+                    for (const std::string & line : documents)
+                        got.append(line);
+                    return fail("LINES per worker", chunkSize, decode, document, expected, got);
+                }
+            }
+        }
+        return true;
+    }
+
+    ///
+    /// A single worker runs the tasks in the order they were submitted, also the ones it submits itself.
+    ///
+    bool checkOrder()
+    {
+        libJSON::JSONThreadPool pool(1);
+        std::vector<int> order;
+        for (int i = 0; i < 1000; ++i)
+        {
+            pool.submit([&pool, &order, i](unsigned worker)
+            {
+                order.push_back(i);
+                if (i == 999)
+                {
+                    for (int k = 1; k <= 3; ++k)
+                        pool.submit([&order, k](unsigned worker) { order.push_back(1000 + k); });
+                }
+            });
+        }
+        pool.wait();
+        std::vector<int> expected;
+        for (int i = 0; i < 1000; ++i)
+            expected.push_back(i);
+        expected.insert(expected.end(), {1001, 1002, 1003});
+        if (order != expected)
+        {
+            std::cerr << "the pool runs its tasks out of order" << std::endl;
+            return false;
+        }
+        return true;
+    }
+
+    ///
+    /// A parse or a wait() on a worker of the pool would wait for itself, so both throw.
+    ///
+    bool checkWorker(libJSON::JSONThreadPool & pool)
+    {
+        int rejected = 0;
+        pool.submit([&pool, &rejected](unsigned worker)
+        {
+            libJSONTest::JSONRecorder recorder;
+            std::vector<libJSONTest::JSONRecorder> recorders(pool.size());
+            ParallelParser parser(pool, ParallelParser::ARRAY);
+            try
+            {
+                parser.parse("[1, 2]", recorder);
+            }
+            catch (const std::logic_error &)
+            {
+                ++rejected;
+            }
+            try
+            {
+                parser.parse("[1, 2]", recorders);
+            }
+            catch (const std::logic_error &)
+            {
+                ++rejected;
+            }
+            try
+            {
+                pool.wait();
+            }
+            catch (const std::logic_error &)
+            {
+                ++rejected;
+            }
+        });
+        pool.wait();
+        if (rejected != 3 || pool.isWorker())
+        {
+            std::cerr << "a parse or wait() on a worker of the pool is not rejected" << std::endl;
+            return false;
+        }
+        return true;
+    }
+}
+
+///
+/// Parses the edge cases and random mutations of them on a thread pool and compares the callbacks
+/// with the ones of a serial BasicJSONParser, as an ARRAY and as LINES of several documents.
+/// Arguments: [mutations = 10000] [threads = 4]
+///
+int main(int argc, char * args[])
+{
+    unsigned iterations = argc > 1 ? std::strtoul(args[1], 0, 10) : 10000;
+    libJSON::JSONThreadPool pool(argc > 2 ? std::strtoul(args[2], 0, 10) : 4);
+    const std::vector<std::string> & documents = libJSONTest::edgeCases();
+
+    if (!checkOrder() || !checkWorker(pool))
+        return EXIT_FAILURE;
+    for (const std::string & document : documents)
+    {
+        if (!checkArray(pool, document) || !checkLines(pool, document))
+            return EXIT_FAILURE;
+    }
+
+    std::mt19937 random(42);
+    for (unsigned i = 0; i < iterations; ++i)
+    {
+        std::string lines;
+        for (unsigned n = 1 + random() % 5; n; --n)
+            lines.append(libJSONTest::mutate(documents[random() % documents.size()], random)).append(random() % 4 ? "\n" : "\n \n");
+        if (!checkArray(pool, libJSONTest::mutate(documents[random() % documents.size()], random)) || !checkLines(pool, lines))
+            return EXIT_FAILURE;
+    }
+    std::cout << checks << " parallel parses identical to the serial parser" << std::endl;
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,318 @@
+//
+//  Part of libJSON, licensed under the GNU Lesser General Public License v3.
+//  Copyright © 2026 the libJSON contributors.
+//
+
+#include "JSONTestSupport.hxx"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+    ///
+    /// An independent recursive descent validator of RFC 8259. It finds the first token, that can
+    /// not continue a valid document, with the lexeme boundaries of the tokenizer: a number ends
+    /// with its grammar, a literal with the next delimiter, an invalid token fails at its start.
+    ///
+    class JSONValidator
+    {
+    public:
+
+        unsigned errorLine;     // the position of the first error, 0 for a valid document
+        unsigned errorColumn;
+
+        JSONValidator(const std::string & text) : errorLine(0), errorColumn(0), text(text), position(0), line(1), column(1) {}
+
+        bool validate()
+        {
+            space();
+            if (!value())
+                return false;
+            space();
+            return position == text.size() || fail();
+        }
+
+    private:
+
+        bool value()
+        {
+            switch (peek())
+            {
+                case '{':
+                    return container('}', true);
+                case '[':
+                    return container(']', false);
+                case '"':
+                    return string();
+                case 't':
+                    return literal("true");
+                case 'f':
+                    return literal("false");
+                case 'n':
+                    return literal("null");
+                default:
+                    return number();
+            }
+        }
+
+        bool container(char close, bool object)
+        {
+            advance(1);
+            space();
+            if (peek() == close)
+            {
+                advance(1);
+                return true;
+            }
+            for (;;)
+            {
+                if (object)
+                {
+                    if (peek() != '"' || !string())
+                        return fail();
+                    space();
+                    if (peek() != ':')
+                        return fail();
+                    advance(1);
+                    space();
+                }
+                if (!value())
+                    return false;
+                space();
+                if (peek() == close)
+                {
+                    advance(1);
+                    return true;
+                }
+                if (peek() != ',')
+                    return fail();
+                advance(1);
+                space();
+            }
+        }
+
+        bool string()
+        {
+            std::size_t end = position + 1;
+            for (;;)
+            {
+                if (end >= text.size() || static_cast<unsigned char>(text[end]) < 0x20)
+                    return fail();
+                if (text[end] == '"')
+                    break;
+                if (text[end] != '\\')
+                    ++end;
+                else if (std::string_view("\"\\/bfnrt").find(at(end + 1)) != std::string_view::npos)
+                    end += 2;
+                else if (at(end + 1) == 'u' && isHex(at(end + 2)) && isHex(at(end + 3)) && isHex(at(end + 4)) && isHex(at(end + 5)))
+                    end += 6;
+                else
+                    return fail();
+            }
+            advance(end + 1 - position);
+            return true;
+        }
+
+        bool literal(std::string_view name)
+        {
+            std::size_t end = position;
+            while (end < text.size() && std::string_view(" \t\n\r[]{},:.\"+-0123456789").find(text[end]) == std::string_view::npos)
+                ++end;
+            if (std::string_view(text).substr(position, end - position) != name)
+                return fail();
+            advance(end - position);
+            return true;
+        }
+
+        bool number()
+        {
+            std::size_t end = position;
+            if (at(end) == '-')
+                ++end;
+            if (at(end) == '0')
+                ++end;
+            else if (!digits(end))
+                return fail();
+            if (at(end) == '.' && !digits(++end))
+                return fail();
+            if (at(end) == 'e' || at(end) == 'E')
+            {
+                ++end;
+                if (at(end) == '+' || at(end) == '-')
+                    ++end;
+                if (!digits(end))
+                    return fail();
+            }
+            advance(end - position);
+            return true;
+        }
+
+        bool digits(std::size_t & end) const
+        {
+            std::size_t begin = end;
+            while (at(end) >= '0' && at(end) <= '9')
+                ++end;
+            return end != begin;
+        }
+
+        static bool isHex(char c)
+        {
+            return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+        }
+
+        /// @return the character at i, or 0 at the end of the document
+        char at(std::size_t i) const { return i < text.size() ? text[i] : 0; }
+        char peek() const { return at(position); }
+
+        void space()
+        {
+            while (position < text.size() && (peek() == ' ' || peek() == '\t' || peek() == '\n' || peek() == '\r'))
+                advance(1);
+        }
+
+        void advance(std::size_t count)
+        {
+            for (; count; --count, ++position)
+            {
+                ++column;
+                if (text[position] == '\n')
+                {
+                    ++line;
+                    column = 1;
+                }
+            }
+        }
+
+        /// The document is invalid from the current token on.
+        bool fail()
+        {
+            errorLine = line;
+            errorColumn = column;
+            return false;
+        }
+
+        const std::string & text;
+        std::size_t position;
+        unsigned line;
+        unsigned column;
+    };
+
+    ///
+    /// Malformed documents beyond the edge cases, mostly for the parse table.
+    ///
+    const char * const malformed[] = {
+        "[1,2,]", "{\"a\":1,,}", "[,1]", "{,\"a\":1}", "{1:2}", "{\"a\"}", "{\"a\":}", "{\"a\"::1}", "[:]", "[1:2]",
+        "[[1]", "{\"a\":{\"b\":[1}", "[1}", "{\"a\":1]", "[{]}", "{\"a\":[}]", "[[[", "{\"a\":{\"b\":",
+        "[1] x", "[] []", "{} 1", "null null", "\"a\" \"b\"", "1 2", "[1]\n,", "[1]]", "{}}", ":", ",", "}", " \n ",
+    };
+
+    ///
+    /// The callbacks of a document, with the texts of the errors left out, and whether it was accepted.
+    ///
+    std::string golden(const std::string & document, unsigned & errorLine, unsigned & errorColumn)
+    {
+        libJSONTest::JSONRecorder recorder;
+        libJSON::BasicJSONParser<libJSONTest::JSONRecorder> parser(recorder);
+        parser << document;
+
+        std::string result("document ");
+        libJSONTest::appendEscaped(result, document);
+        result.append("\n");
+        std::istringstream events(recorder.events);
+        errorLine = errorColumn = 0;
+        for (std::string event; std::getline(events, event); )
+        {
+            if (event.compare(0, 6, "error ") == 0)
+            {
+                event.erase(event.find(' ', 6));
+                if (!errorLine)
+                    std::sscanf(event.c_str(), "error %u,%u", &errorLine, &errorColumn);
+            }
+            result.append(event).append("\n");
+        }
+        if (errorLine)
+            result.append("rejected at ").append(std::to_string(errorLine)).append(",").append(std::to_string(errorColumn)).append("\n\n");
+        else
+            result.append("accepted\n\n");
+        return result;
+    }
+
+    bool agrees(const std::string & document, unsigned errorLine, unsigned errorColumn)
+    {
+        JSONValidator validator(document);
+        if (validator.validate() == !errorLine && validator.errorLine == errorLine && validator.errorColumn == errorColumn)
+            return true;
+        std::string escaped;
+        libJSONTest::appendEscaped(escaped, document);
+        std::cerr << "the parser " << (errorLine ? "rejects " : "accepts ") << escaped << " at " << errorLine << "," << errorColumn
+                  << ", the validator at " << validator.errorLine << "," << validator.errorColumn << std::endl;
+        return false;
+    }
+}
+
+///
+/// Compares the callbacks, acceptance and first error position of the parser for the edge cases
+/// and the malformed documents with a golden file, and acceptance and first error position of
+/// these and random mutations of them with an independent validator.
+/// Arguments: golden file [file to write the current output to] [mutations = 100000]
+///
+int main(int argc, char * args[])
+{
+    if (argc < 2)
+    {
+        std::cerr << "usage: " << args[0] << " golden-file [output-file] [mutations]" << std::endl;
+        return EXIT_FAILURE;
+    }
+    unsigned iterations = argc > 3 ? std::strtoul(args[3], 0, 10) : 100000;
+    std::vector<std::string> documents = libJSONTest::edgeCases();
+    documents.insert(documents.end(), std::begin(malformed), std::end(malformed));
+
+    std::string output;
+    bool agreed = true;
+    for (const std::string & document : documents)
+    {
+        unsigned errorLine, errorColumn;
+        output.append(golden(document, errorLine, errorColumn));
+        agreed = agrees(document, errorLine, errorColumn) && agreed;
+    }
+    if (argc > 2 && args[2][0])
+        std::ofstream(args[2], std::ios::binary) << output;
+
+    std::ifstream file(args[1], std::ios::binary);
+    std::string expected((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    if (output != expected)
+    {
+        // report the first document that differs
+        std::size_t begin = output.rfind("\ndocument ", std::mismatch(output.begin(), output.end(), expected.begin(), expected.end()).first - output.begin());
+        begin = begin == std::string::npos ? 0 : begin + 1;
+        std::cerr << "the callbacks differ from " << args[1] << " from:" << std::endl
+                  << "expected:" << std::endl << expected.substr(begin, expected.find("\n\n", begin) - begin) << std::endl
+                  << "got:" << std::endl << output.substr(begin, output.find("\n\n", begin) - begin) << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::mt19937 random(42);
+    std::size_t rejected = 0;
+    for (unsigned i = 0; i < iterations && agreed; ++i)
+    {
+        std::string document = libJSONTest::mutate(documents[random() % documents.size()], random);
+        unsigned errorLine, errorColumn;
+        golden(document, errorLine, errorColumn);
+        agreed = agrees(document, errorLine, errorColumn);
+        rejected += errorLine != 0;
+    }
+    if (!agreed)
+        return EXIT_FAILURE;
+    std::cout << documents.size() << " documents as in " << args[1] << ", " << iterations << " mutations ("
+              << rejected << " rejected) as the validator" << std::endl;
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,202 @@
+//
+//  Part of libJSON, licensed under the GNU Lesser General Public License v3.
+//  Copyright © 2026 the libJSON contributors.
+//
+
+#include "JSONTestSupport.hxx"
+#include "SimpleJSONParser.hxx"
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+    ///
+    /// Records the std::string callbacks of the virtual interface like a JSONRecorder.
+    ///
+    class RecordingParser : public libJSONImpl::SimpleJSONParser
+    {
+    public:
+
+        libJSONTest::JSONRecorder recorder;
+
+        RecordingParser(bool zeroCopy, bool decode) : libJSONImpl::SimpleJSONParser(false, zeroCopy, decode) {}
+
+        virtual void boolean(unsigned line, unsigned column, const std::string & text) { recorder.boolean(line, column, text); }
+        virtual void endArray(unsigned line, unsigned column, const std::string & text) { recorder.endArray(line, column, text); }
+        virtual void endDocument() { recorder.endDocument(); }
+        virtual void endObject(unsigned line, unsigned column, const std::string & text) { recorder.endObject(line, column, text); }
+        virtual void error(unsigned line, unsigned column, const std::string & text) { recorder.error(line, column, text); }
+        virtual void memberValue(unsigned line, unsigned column, const std::string & text) { recorder.memberValue(line, column, text); }
+        virtual void nextElement(unsigned line, unsigned column, const std::string & text) { recorder.nextElement(line, column, text); }
+        virtual void null(unsigned line, unsigned column, const std::string & text) { recorder.null(line, column, text); }
+        virtual void number(unsigned line, unsigned column, const std::string & number) { recorder.number(line, column, number); }
+        virtual void space(unsigned line, unsigned column, const std::string & text) { recorder.space(line, column, text); }
+        virtual void startArray(unsigned line, unsigned column, const std::string & text) { recorder.startArray(line, column, text); }
+        virtual void startDocument() { recorder.startDocument(); }
+        virtual void startObject(unsigned line, unsigned column, const std::string & text) { recorder.startObject(line, column, text); }
+        virtual void string(unsigned line, unsigned column, const std::string & text) { recorder.string(line, column, text); }
+        virtual void decodedString(unsigned line, unsigned column, std::string_view text) { recorder.decodedString(line, column, text); }
+        virtual void decodedNumber(unsigned line, unsigned column, const libJSON::JSONNumber & number) { recorder.decodedNumber(line, column, number); }
+    };
+
+    ///
+    /// The parsers under test, each reused for all splits of all documents.
+    ///
+    struct Parsers
+    {
+        bool decode;
+        libJSONTest::JSONRecorder recorder;
+        libJSON::BasicJSONParser<libJSONTest::JSONRecorder> basic;
+        RecordingParser copying;
+        RecordingParser zeroCopy;
+
+        Parsers(bool decode) : decode(decode), basic(recorder, decode), copying(false, decode), zeroCopy(true, decode) {}
+    };
+
+    std::size_t checks = 0;
+
+    ///
+    /// Feeds the pieces from a buffer, which is overwritten behind every call, so a callback of a
+    /// later piece can not get the text of an earlier one.
+    ///
+    template <class Parser>
+    void push(Parser & parser, const std::string & document, const std::vector<std::size_t> & splits)
+    {
+        std::string buffer;
+        std::size_t begin = 0;
+        for (std::size_t i = 0; i <= splits.size(); ++i)
+        {
+            std::size_t end = i < splits.size() ? splits[i] : document.size();
+            buffer.assign(document, begin, end - begin);
+            parser.feed(buffer.data(), buffer.size());
+            std::fill(buffer.begin(), buffer.end(), '"');
+            begin = end;
+        }
+        parser.finish();
+    }
+
+    bool compare(const char * name, Parsers & parsers, const std::string & document, const std::vector<std::size_t> & splits,
+                 const std::string & expected, const std::string & events)
+    {
+        ++checks;
+        if (events == expected)
+            return true;
+        std::cerr << name << (parsers.decode ? " with decode" : "") << " differs on [" << document << "] split at";
+        for (std::size_t split : splits)
+            std::cerr << " " << split;
+        std::cerr << std::endl << "expected:" << std::endl << expected << "got:" << std::endl << events;
+        return false;
+    }
+
+    ///
+    /// Pushes the document in the given pieces to all parsers and compares their callbacks with
+    /// the ones of parsing the whole document at once.
+    ///
+    bool check(Parsers & parsers, const std::string & document, const std::string & expected, const std::vector<std::size_t> & splits)
+    {
+        parsers.recorder.events.clear();
+        push(parsers.basic, document, splits);
+        if (!compare("BasicJSONParser", parsers, document, splits, expected, parsers.recorder.events))
+            return false;
+        for (RecordingParser * parser : {&parsers.copying, &parsers.zeroCopy})
+        {
+            parser->recorder.events.clear();
+            push(*parser, document, splits);
+            if (!compare(parser == &parsers.copying ? "SimpleJSONParser" : "SimpleJSONParser with zeroCopy",
+                         parsers, document, splits, expected, parser->recorder.events))
+                return false;
+        }
+        return true;
+    }
+
+    ///
+    /// Every split into two pieces, every split into three pieces of a short document, and one byte at a time.
+    ///
+    bool checkSplits(Parsers & parsers, const std::string & document)
+    {
+        libJSONTest::JSONRecorder recorder;
+        libJSON::BasicJSONParser<libJSONTest::JSONRecorder>(recorder, parsers.decode) << document;
+        const std::string & expected = recorder.events;
+
+        std::vector<std::size_t> splits;
+        if (!check(parsers, document, expected, splits))
+            return false;
+        for (std::size_t first = 0; first <= document.size(); ++first)
+        {
+            if (!check(parsers, document, expected, {first}))
+                return false;
+            for (std::size_t second = first; document.size() <= 24 && second <= document.size(); ++second)
+            {
+                if (!check(parsers, document, expected, {first, second}))
+                    return false;
+            }
+        }
+        for (std::size_t split = 1; split < document.size(); ++split)
+            splits.push_back(split);
+        return check(parsers, document, expected, splits);
+    }
+
+    ///
+    /// A parse between feed() calls abandons the pushed document with an error at the end of its
+    /// last piece, and the next feed() starts a new document, so both parse as if they were alone.
+    ///
+    template <class Parser>
+    bool checkInterrupted(const char * name, Parser & parser, libJSONTest::JSONRecorder & recorder, bool decode)
+    {
+        const std::string first("[1, [2"), second("{\"a\": [3]}"), third("[4]");
+        libJSONTest::JSONRecorder expected;
+        libJSON::BasicJSONParser<libJSONTest::JSONRecorder>(expected, decode).feed(first.data(), first.size());
+        expected.events.append("error 1,7 \"unfinished pushed JSON document abandoned\"\nendDocument\n");
+        libJSON::BasicJSONParser<libJSONTest::JSONRecorder>(expected, decode) << second;
+        libJSON::BasicJSONParser<libJSONTest::JSONRecorder>(expected, decode).feed(third.data(), third.size()).finish();
+
+        recorder.events.clear();
+        parser.feed(first.data(), first.size());
+        parser << second;
+        parser.feed(third.data(), third.size()).finish();
+        ++checks;
+        if (recorder.events == expected.events)
+            return true;
+        std::cerr << name << (decode ? " with decode" : "") << " does not abandon a pushed document on a parse" << std::endl
+                  << "expected:" << std::endl << expected.events << "got:" << std::endl << recorder.events;
+        return false;
+    }
+}
+
+///
+/// Pushes the edge cases and random mutations of them in pieces to a BasicJSONParser and to a
+/// SimpleJSONParser, with and without decode, and compares the callbacks with a single parse.
+/// Arguments: [mutations = 2000]
+///
+int main(int argc, char * args[])
+{
+    unsigned iterations = argc > 1 ? std::strtoul(args[1], 0, 10) : 2000;
+    const std::vector<std::string> & documents = libJSONTest::edgeCases();
+    Parsers withoutDecode(false);
+    Parsers withDecode(true);
+
+    for (Parsers * parsers : {&withoutDecode, &withDecode})
+    {
+        if (!checkInterrupted("BasicJSONParser", parsers->basic, parsers->recorder, parsers->decode) ||
+            !checkInterrupted("SimpleJSONParser", parsers->copying, parsers->copying.recorder, parsers->decode) ||
+            !checkInterrupted("SimpleJSONParser with zeroCopy", parsers->zeroCopy, parsers->zeroCopy.recorder, parsers->decode))
+            return EXIT_FAILURE;
+    }
+
+    std::mt19937 random(42);
+    for (unsigned i = 0; i < documents.size() + iterations; ++i)
+    {
+        std::string document = i < documents.size() ? documents[i] : libJSONTest::mutate(documents[random() % documents.size()], random);
+        for (Parsers * parsers : {&withoutDecode, &withDecode})
+        {
+            if (!checkSplits(*parsers, document))
+                return EXIT_FAILURE;
+        }
+    }
+    std::cout << checks << " pushed documents identical to a single parse" << std::endl;
+    return EXIT_SUCCESS;
+}
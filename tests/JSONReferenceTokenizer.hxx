@@ -0,0 +1,382 @@
+//
+//  Part of libJSON, licensed under the GNU Lesser General Public License v3.
+//  Copyright © 2026 the libJSON contributors.
+//
+
+#ifndef JSONReferenceTokenizer_hxx
+#define JSONReferenceTokenizer_hxx
+
+#include <libJSON/JSONTokenizer.hxx>
+#include <iostream>
+#include <string>
+
+namespace libJSONTest
+{
+    using namespace libJSONImpl;
+
+    struct JSONReferenceToken
+    {
+        JSONTagType tag;
+        std::string value;
+        unsigned line;
+        unsigned column;
+
+        void clear()
+        {
+            tag = eof;
+            line = 0;
+            column = 0;
+            value.clear();
+        }
+    };
+
+    ///
+    /// The character at a time state machine, which tokenized the stream with peek() and ignore()
+    /// before the block tokenizer. The JSONTokenizer must produce the same tags, text and positions.
+    ///
+    struct JSONReferenceTokenizer
+    {
+        std::istream & document;
+        unsigned line;
+        unsigned column;
+        
+        JSONReferenceTokenizer(std::istream & document) : document(document), line(1), column(1) {}
+        
+        void next(JSONReferenceToken & token)
+        {
+            enum {
+                S_START,
+                S_SPACE,
+                S_NUMBER_1_9,
+                S_NUMBER_0,
+                S_NUMBER_MINUS,
+                S_NUMBER_FRAC,
+                S_NUMBER_FRAC_DIGITS,
+                S_NUMBER_EXP,
+                S_NUMBER_EXP_SIGN,
+                S_NUMBER_EXP_DIGITS,
+                S_STRING,
+                S_ESCAPE,
+                S_HEX1,
+                S_HEX2,
+                S_HEX3,
+                S_HEX4,
+                S_LITERAL,
+                S_STOP
+            } state = S_START;
+            token.clear();
+            token.line = line;
+            token.column = column;
+            
+            while (state != S_STOP && document.good())
+            {
+                int c = document.peek();
+                switch (state)
+                {
+                    case S_START:
+                        if (c == ' ' || c == '\u000a' || c == '\u000d' || c == '\u0009')
+                        {
+                            token.tag = SPACE;
+                            state = S_SPACE;
+                        }
+                        else if (c == '[')
+                        {
+                            token.tag = OPEN_BRACKET;
+                            state = S_STOP;
+                        }
+                        else if (c == ']')
+                        {
+                            token.tag = CLOSE_BRACKET;
+                            state = S_STOP;
+                        }
+                        else if (c == '{')
+                        {
+                            token.tag = OPEN_BRACE;
+                            state = S_STOP;
+                        }
+                        else if (c == '}')
+                        {
+                            token.tag = CLOSE_BRACE;
+                            state = S_STOP;
+                        }
+                        else if (c == ',')
+                        {
+                            token.tag = COMMA;
+                            state = S_STOP;
+                        }
+                        else if (c == ':')
+                        {
+                            token.tag = COLON;
+                            state = S_STOP;
+                        }
+                        else if (c == '-')
+                        {
+                            token.tag = NUMBER;
+                            state = S_NUMBER_MINUS;
+                        }
+                        else if (c == '0')
+                        {
+                            token.tag = NUMBER;
+                            state = S_NUMBER_0;
+                        }
+                        else if (c >= '1' && c <= '9')
+                        {
+                            token.tag = NUMBER;
+                            state = S_NUMBER_1_9;
+                        }
+                        else if (c == '"')
+                        {
+                            token.tag = STRING;
+                            state = S_STRING;
+                        }
+                        else if (c == EOF)
+                        {
+                            state = S_STOP;
+                        }
+                        else
+                        {
+                            token.tag = ERROR;
+                            state = S_LITERAL;
+                        }
+                        break; // S_START
+                    case S_SPACE:
+                        if (! (c == ' ' || c == '\u000a' || c == '\u000d' || c == '\u0009'))
+                        {
+                            state = S_STOP;
+                            c = EOF;
+                        }
+                        break; // S_SPACE
+                    case S_NUMBER_MINUS:
+                        if (c == '0')
+                        {
+                            state = S_NUMBER_0;
+                        }
+                        else if (c >= '1' && c <= '9')
+                        {
+                            state = S_NUMBER_1_9;
+                        }
+                        else
+                        {
+                            token.tag = ERROR;
+                            state = S_STOP;
+                            c = EOF;
+                        }
+                        break; // S_NUMBER_MINUS
+                    case S_NUMBER_0:
+                        if (c == '.')
+                        {
+                            state = S_NUMBER_FRAC;
+                        }
+                        else if (c == 'e' || c == 'E')
+                        {
+                            state = S_NUMBER_EXP;
+                        }
+                        else
+                        {
+                            state = S_STOP;
+                            c = EOF;
+                        }
+                        break; // S_NUMBER_0
+                    case S_NUMBER_1_9:
+                        if (c == '.')
+                        {
+                            state = S_NUMBER_FRAC;
+                        }
+                        else if (c == 'e' || c == 'E')
+                        {
+                            state = S_NUMBER_EXP;
+                        }
+                        else if (! (c >= '0' && c <= '9'))
+                        {
+                            state = S_STOP;
+                            c = EOF;
+                        }
+                        break; // S_NUMBER_1_9
+                    case S_NUMBER_FRAC:
+                        if (c >= '0' && c <= '9')
+                        {
+                            state = S_NUMBER_FRAC_DIGITS;
+                        }
+                        else
+                        {
+                            token.tag = ERROR;
+                            state = S_STOP;
+                            c = EOF;
+                        }
+                        break; // S_NUMBER_FRAC
+                    case S_NUMBER_FRAC_DIGITS:
+                        if (c == 'e' || c =='E')
+                        {
+                            state = S_NUMBER_EXP;
+                        }
+                        else if (! (c >= '0' && c <= '9'))
+                        {
+                            state = S_STOP;
+                            c = EOF;
+                        }
+                        break; // S_NUMBER_FRAC_DIGITS
+                    case S_NUMBER_EXP:
+                        if (c == '+' || c == '-')
+                        {
+                            state = S_NUMBER_EXP_SIGN;
+                        }
+                        else if (c >= '0' && c <= '9')
+                        {
+                            state = S_NUMBER_EXP_DIGITS;
+                        }
+                        else
+                        {
+                            token.tag = ERROR;
+                            state = S_STOP;
+                            c = EOF;
+                        }
+                        break; // S_NUMBER_EXP
+                    case S_NUMBER_EXP_SIGN:
+                        if (c >= '0' && c <= '9')
+                        {
+                            state = S_NUMBER_EXP_DIGITS;
+                        }
+                        else
+                        {
+                            token.tag = ERROR;
+                            state = S_STOP;
+                            c = EOF;
+                        }
+                        break; // S_NUMBER_EXP_SIGN
+                    case S_NUMBER_EXP_DIGITS:
+                        if (! (c >= '0' && c <= '9'))
+                        {
+                            state = S_STOP;
+                            c = EOF;
+                        }
+                        break; // S_NUMBER_EXP_DIGITS
+                    case S_LITERAL:
+                        if (c == ' ' || c == '\u000a' || c == '\u000d' || c == '\u0009' ||
+                            c == '[' || c == ']' ||
+                            c == '{' || c == '}' ||
+                            c == ',' || c == ':' || c == '.' || c == '"' ||
+                            c == '+' || c == '-' ||
+                            (c >= '0' && c <= '9'))
+                        {
+                            state = S_STOP;
+                            c = EOF;
+                        }
+                        if (c == EOF)
+                        {
+                            if (token.value.compare("true") == 0)
+                                token.tag = L_TRUE;
+                            else if (token.value.compare("false") == 0)
+                                token.tag = L_FALSE;
+                            else if (token.value.compare("null") == 0)
+                                token.tag = L_NULL;
+                        }
+                        break; // S_LITERAL
+                    case S_STRING:
+                        if (c == '"')
+                        {
+                            state = S_STOP;
+                        }
+                        else if (c == '\\')
+                        {
+                            state = S_ESCAPE;
+                        }
+                        else if (c < '\u0020')
+                        {
+                            token.tag = ERROR;
+                            state = S_STOP;
+                            c = EOF;
+                        }
+                        break; // S_STRING
+                    case S_ESCAPE:
+                        if (c == '"' || c ==  '\\' || c == '/' || c == 'b' || c == 'f' ||
+                            c == 'n' || c == 'r' || c == 't')
+                        {
+                            state = S_STRING;
+                        }
+                        else if (c == 'u')
+                        {
+                            state = S_HEX1;
+                        }
+                        else
+                        {
+                            token.tag = ERROR;
+                            state = S_STOP;
+                            c = EOF;
+                        }
+                        break; // S_ESCAPE
+                    case S_HEX1:
+                        if ((c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F'))
+                        {
+                            state = S_HEX2;
+                        }
+                        else
+                        {
+                            token.tag = ERROR;
+                            state = S_STOP;
+                            c = EOF;
+                        }
+                        break; // S_HEX1
+                    case S_HEX2:
+                        if ((c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F'))
+                        {
+                            state = S_HEX3;
+                        }
+                        else
+                        {
+                            token.tag = ERROR;
+                            state = S_STOP;
+                            c = EOF;
+                        }
+                        break; // S_HEX2
+                    case S_HEX3:
+                        if ((c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F'))
+                        {
+                            state = S_HEX4;
+                        }
+                        else
+                        {
+                            token.tag = ERROR;
+                            state = S_STOP;
+                            c = EOF;
+                        }
+                        break; // S_HEX3
+                    case S_HEX4:
+                        if ((c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F'))
+                        {
+                            state = S_STRING;
+                        }
+                        else
+                        {
+                            token.tag = ERROR;
+                            state = S_STOP;
+                            c = EOF;
+                        }
+                        break; // S_HEX4
+                    case S_STOP:
+                        break;
+                }
+
+                if (c != EOF)
+                {
+                    token.value.append(1, static_cast<char>(c));
+                    document.ignore(1);
+                    ++column;
+                    if (c == '\u000a')
+                    {
+                        ++line;
+                        column = 1;
+                    }
+                }
+                else if (document.eof())
+                    break;
+                else if (document.fail())
+                {
+                    token.tag = ERROR;
+                    break;
+                }
+            }
+        }
+    };
+}
+
+#endif // JSONReferenceTokenizer_hxx
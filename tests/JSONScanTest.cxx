@@ -0,0 +1,182 @@
+//
+//  Part of libJSON, licensed under the GNU Lesser General Public License v3.
+//  Copyright © 2026 the libJSON contributors.
+//
+
+#include "JSONReferenceTokenizer.hxx"
+#include <libJSON/JSONScan.hxx>
+#include <libJSON/JSONTokenizer.hxx>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+namespace
+{
+    ///
+    /// Runs of whitespace, string characters and digits across the 16 and 32 byte blocks of the
+    /// vector kernels, with all bytes that end a run.
+    ///
+    bool checkKernels(const libJSONImpl::JSONScanKernels & kernels, unsigned iterations)
+    {
+        const libJSONImpl::JSONScanKernels & scalar = libJSONImpl::JSONScanKernels::scalar();
+        const char alphabet[] = " \n\r\t0123456789\"\\a\x01\x1f\x20\x80\xff";
+        const unsigned letters = sizeof(alphabet) - 1;
+        std::mt19937 random(7);
+        for (unsigned i = 0; i < iterations; ++i)
+        {
+            // mostly characters of one run, so the runs get longer than a block
+            std::string block(random() % 100, ' ');
+            unsigned run = random() % 4 * 4;
+            for (char & c : block)
+                c = random() % 8 ? alphabet[run + random() % 4] : alphabet[random() % letters];
+            const char * begin = block.data();
+            const char * end = begin + block.size();
+            unsigned newlines = 0, scalarNewlines = 0;
+            const char * lastNewline = 0;
+            const char * scalarLastNewline = 0;
+            if (kernels.space(begin, end, newlines, lastNewline) != scalar.space(begin, end, scalarNewlines, scalarLastNewline) ||
+                newlines != scalarNewlines || lastNewline != scalarLastNewline ||
+                kernels.string(begin, end) != scalar.string(begin, end) ||
+                kernels.digits(begin, end) != scalar.digits(begin, end))
+            {
+                std::cerr << kernels.name << " kernels differ from the scalar kernels on [" << block << "]" << std::endl;
+                return false;
+            }
+        }
+        return true;
+    }
+
+    ///
+    /// Hands out one piece per underflow(), like a pipe, on which a writer is still writing.
+    ///
+    struct PipeBuffer : public std::streambuf
+    {
+        std::vector<std::string> pieces;
+        std::size_t read;   // the pieces handed out so far
+
+        PipeBuffer(const std::vector<std::string> & pieces) : pieces(pieces), read(0) {}
+
+        virtual int_type underflow()
+        {
+            if (read == pieces.size())
+                return traits_type::eof();
+            std::string & piece = pieces[read++];
+            setg(&piece[0], &piece[0], &piece[0] + piece.size());
+            return traits_type::to_int_type(*gptr());
+        }
+    };
+
+    ///
+    /// A token is delivered as soon as the pieces of a stream complete it, and the end of the
+    /// stream only sets its eofbit.
+    ///
+    bool checkPipe()
+    {
+        PipeBuffer pipe({"[1, ", "22, ", "333", "]"});
+        std::istream stream(&pipe);
+        libJSONImpl::JSONTokenizer tokenizer(stream);
+        std::vector<std::size_t> read;
+        libJSONImpl::JSONToken token;
+        do
+        {
+            tokenizer.next(token);
+            if (token.tag == libJSONImpl::NUMBER)
+                read.push_back(pipe.read);
+        }
+        while (token.tag != libJSONImpl::eof);
+        if (read != std::vector<std::size_t>({1, 2, 4}))
+        {
+            std::cerr << "the tokenizer reads ahead of the tokens of a stream" << std::endl;
+            return false;
+        }
+        if (stream.rdstate() != std::ios::eofbit)
+        {
+            std::cerr << "the tokenizer leaves the stream in state " << stream.rdstate() << " instead of eofbit" << std::endl;
+            return false;
+        }
+        return true;
+    }
+
+    const std::string pieces[] = {
+        " ", "\n", "\r\n", "\t", "   \n  \n ", "[", "]", "{", "}", ",", ":", "\"", "\\", "\\u", "00e9", "\\n", "\\f", "abc",
+        "0", "-", "123", "1234567890123456789012345678901234567890", ".", "e", "E+", "-5", "true", "false", "null", "tru", "x",
+        "\x01", "\xc3\xa9", "\"aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa\"", "\"ab\\\"c\"", std::string(70, ' '),
+        std::string(40, '\n'), "+", "\x80\xff"
+    };
+
+    ///
+    /// Random documents, mostly invalid, tokenized from a buffer and from streams with small chunks,
+    /// must give the same tags, text and positions as the reference state machine.
+    ///
+    bool checkTokenizer(const libJSONImpl::JSONScanKernels & kernels, unsigned iterations, std::size_t & tokens)
+    {
+        std::mt19937 random(42);
+        for (unsigned i = 0; i < iterations; ++i)
+        {
+            std::string document;
+            for (unsigned n = random() % 40; n; --n)
+                document.append(pieces[random() % (sizeof(pieces) / sizeof(pieces[0]))]);
+
+            std::istringstream referenceStream(document);
+            libJSONTest::JSONReferenceTokenizer reference(referenceStream);
+            std::istringstream stream(document);
+            std::unique_ptr<libJSONImpl::JSONTokenizer> tokenizer;
+            if (i % 3 == 0)
+                tokenizer.reset(new libJSONImpl::JSONTokenizer(document.data(), document.data() + document.size()));
+            else
+                tokenizer.reset(new libJSONImpl::JSONTokenizer(stream, 1 + random() % 20));
+            tokenizer->kernels = &kernels;
+            tokenizer->zeroCopy = random() % 2;
+            tokenizer->decode = random() % 2;
+
+            libJSONTest::JSONReferenceToken expected;
+            libJSONImpl::JSONToken token;
+            do
+            {
+                reference.next(expected);
+                tokenizer->next(token);
+                ++tokens;
+                if (token.tag != expected.tag || token.text != expected.value || token.line != expected.line || token.column != expected.column)
+                {
+                    std::cerr << kernels.name << " tokenizer differs on [" << document << "]" << std::endl
+                              << " expected (" << expected.line << "," << expected.column << ") " << expected.tag << ": " << expected.value << std::endl
+                              << " got " << token << std::endl;
+                    return false;
+                }
+            }
+            while (expected.tag != libJSONImpl::eof);
+        }
+        return true;
+    }
+}
+
+///
+/// Checks every scan kernel the running CPU supports against the scalar kernels, and the block
+/// tokenizer with each of them against the reference state machine, and reading a stream in pieces.
+/// Arguments: [documents per kernel = 100000]
+///
+int main(int argc, char * args[])
+{
+    unsigned iterations = argc > 1 ? std::strtoul(args[1], 0, 10) : 100000;
+    std::vector<const libJSONImpl::JSONScanKernels *> kernels = {&libJSONImpl::JSONScanKernels::scalar()};
+    if (libJSONImpl::JSONScanKernels::sse2())
+        kernels.push_back(libJSONImpl::JSONScanKernels::sse2());
+    if (libJSONImpl::JSONScanKernels::avx2())
+        kernels.push_back(libJSONImpl::JSONScanKernels::avx2());
+
+    if (!checkPipe())
+        return EXIT_FAILURE;
+    for (const libJSONImpl::JSONScanKernels * kernel : kernels)
+    {
+        std::size_t tokens = 0;
+        if (!checkKernels(*kernel, 5 * iterations) || !checkTokenizer(*kernel, iterations, tokens))
+            return EXIT_FAILURE;
+        std::cout << kernel->name << ": " << tokens << " tokens identical" << std::endl;
+    }
+    return EXIT_SUCCESS;
+}
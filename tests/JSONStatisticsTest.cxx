@@ -0,0 +1,90 @@
+//
+//  Part of libJSON, licensed under the GNU Lesser General Public License v3.
+//  Copyright © 2026 the libJSON contributors.
+//
+
+#include <libJSON/libJSON.hxx>
+#include <libJSON/JSONTokenizer.hxx>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+
+namespace
+{
+    int failures = 0;
+
+    void check(bool condition, const char * what)
+    {
+        if (!condition)
+        {
+            std::cerr << "failed: " << what << std::endl;
+            ++failures;
+        }
+    }
+
+    ///
+    /// @return whether the counters are the ones of the document below, parsed count times
+    ///
+    bool counted(const libJSONImpl::JSONStatistics & statistics, std::uint64_t bytes, std::uint64_t count)
+    {
+        using namespace libJSONImpl;
+        std::uint64_t expected[ERROR + 1] = {};
+        expected[SPACE] = 6;
+        expected[NUMBER] = 1;
+        expected[STRING] = 3;
+        expected[L_TRUE] = 1;
+        expected[L_NULL] = 1;
+        expected[OPEN_BRACKET] = 1;
+        expected[CLOSE_BRACKET] = 1;
+        expected[OPEN_BRACE] = 1;
+        expected[CLOSE_BRACE] = 1;
+        expected[COMMA] = 3;
+        expected[COLON] = 2;
+        for (int tag = 0; tag <= ERROR; ++tag)
+            if (tag != eof && statistics.tokens[tag] != count * expected[tag])
+                return false;
+        return statistics.bytes == count * bytes && statistics.maxDepth >= 2 &&
+               statistics.shifts > 0 && statistics.reductions > 0;
+    }
+
+    bool cleared(const libJSONImpl::JSONStatistics & statistics)
+    {
+        for (std::uint64_t tokens : statistics.tokens)
+            if (tokens)
+                return false;
+        return statistics.bytes == 0 && statistics.shifts == 0 && statistics.reductions == 0 && statistics.maxDepth == 0;
+    }
+}
+
+///
+/// Reads the counters of a known document through libJSON::SimpleJSONParser. Built with
+/// LIBJSON_STATISTICS they count its tokens, otherwise they stay 0.
+///
+int main(int argc, char * args[])
+{
+    const std::string document("{\"a\": [1, true, null], \"b\": \"x\"}\n");
+    std::unique_ptr<libJSON::SimpleJSONParser> parser(libJSON::SimpleJSONParser::Create());
+
+    *parser << document;
+    if (!libJSONImpl::JSONStatistics::enabled)
+    {
+        check(cleared(parser->statistics()), "no counters without LIBJSON_STATISTICS");
+        return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+    }
+    check(counted(parser->statistics(), document.size(), 1), "the tokens of a document");
+
+    std::istringstream stream(document);
+    *parser << stream;
+    check(counted(parser->statistics(), document.size(), 2), "the counters add up over a parse of a stream");
+
+    parser->statistics().clear();
+    check(cleared(parser->statistics()), "clear()");
+    parser->feed(document.data(), 10).feed(document.data() + 10, document.size() - 10).finish();
+    check(counted(parser->statistics(), document.size(), 1), "the tokens of a pushed document");
+
+    if (failures)
+        std::cerr << parser->statistics();
+    return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
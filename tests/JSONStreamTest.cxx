@@ -0,0 +1,58 @@
+//
+//  Part of libJSON, licensed under the GNU Lesser General Public License v3.
+//  Copyright © 2026 the libJSON contributors.
+//
+
+#include "JSONTestSupport.hxx"
+#include "SimpleJSONParser.hxx"
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+namespace
+{
+    ///
+    /// Counts the errors, so a document that is rejected early can not pass as a small peak memory.
+    ///
+    class CountingParser : public libJSONImpl::SimpleJSONParser
+    {
+    public:
+
+        std::size_t errors;
+
+        CountingParser() : libJSONImpl::SimpleJSONParser(false), errors(0) {}
+
+        virtual void error(unsigned line, unsigned column, const std::string & text)
+        {
+            std::cerr << "(" << line << "," << column << ") " << text << std::endl;
+            ++errors;
+        }
+    };
+}
+
+///
+/// Parses a generated array from a stream and fails, if the peak resident memory grows by more
+/// than a fixed ceiling, i.e. if the parser holds on to the text of the document.
+/// Arguments: [megabytes = 1024] [ceiling in kB = 8192]
+///
+int main(int argc, char * args[])
+{
+    std::size_t megabytes = argc > 1 ? std::strtoul(args[1], 0, 10) : 1024;
+    std::size_t limitKilobytes = argc > 2 ? std::strtoul(args[2], 0, 10) : 8 * 1024;
+
+    std::size_t before = libJSONTest::peakResidentKilobytes();
+    CountingParser parser;
+    libJSONTest::GeneratedArray generatedArray(megabytes * 1024 * 1024);
+    std::istream document(&generatedArray);
+    parser << document;
+    std::size_t growth = libJSONTest::peakResidentKilobytes() - before;
+
+    std::cout << "streamed " << generatedArray.generated << " bytes, peak RSS growth "
+              << growth << " kB (limit " << limitKilobytes << " kB)" << std::endl;
+    if (parser.errors || generatedArray.generated < megabytes * 1024 * 1024 || !generatedArray.closed)
+    {
+        std::cerr << "the document was not parsed completely" << std::endl;
+        return EXIT_FAILURE;
+    }
+    return growth <= limitKilobytes ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,198 @@
+//
+//  Part of libJSON, licensed under the GNU Lesser General Public License v3.
+//  Copyright © 2026 the libJSON contributors.
+//
+
+#ifndef JSONTestSupport_hxx
+#define JSONTestSupport_hxx
+
+#include <libJSON/BasicJSONParser.hxx>
+#include <cstdio>
+#include <random>
+#include <streambuf>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <sys/resource.h>
+
+namespace libJSONTest
+{
+    ///
+    /// Appends the text in double quotes, with control characters, quotes, backslashes and
+    /// bytes beyond ASCII escaped, so that it fits on one line.
+    ///
+    inline void appendEscaped(std::string & result, std::string_view text)
+    {
+        result.push_back('"');
+        for (char c : text)
+        {
+            unsigned char byte = static_cast<unsigned char>(c);
+            if (c == '"' || c == '\\')
+                result.append(1, '\\').append(1, c);
+            else if (c == '\n')
+                result.append("\\n");
+            else if (c == '\r')
+                result.append("\\r");
+            else if (c == '\t')
+                result.append("\\t");
+            else if (byte < 0x20 || byte >= 0x7F)
+            {
+                char buffer[8];
+                std::snprintf(buffer, sizeof(buffer), "\\x%02X", byte);
+                result.append(buffer);
+            }
+            else
+                result.push_back(c);
+        }
+        result.push_back('"');
+    }
+
+    ///
+    /// Records all callbacks with their positions and escaped text as one line each, so the
+    /// output of two parsers can be compared as a whole.
+    ///
+    struct JSONRecorder : public libJSON::JSONHandler
+    {
+        std::string events;
+
+        void record(const char * name, unsigned line, unsigned column, std::string_view text)
+        {
+            events.append(name).append(" ").append(std::to_string(line)).append(",").append(std::to_string(column)).append(" ");
+            appendEscaped(events, text);
+            events.append("\n");
+        }
+
+        void boolean(unsigned line, unsigned column, std::string_view text) { record("boolean", line, column, text); }
+        void endArray(unsigned line, unsigned column, std::string_view text) { record("endArray", line, column, text); }
+        void endDocument() { events.append("endDocument\n"); }
+        void endObject(unsigned line, unsigned column, std::string_view text) { record("endObject", line, column, text); }
+        void error(unsigned line, unsigned column, const std::string & text) { record("error", line, column, text); }
+        void memberValue(unsigned line, unsigned column, std::string_view text) { record("memberValue", line, column, text); }
+        void nextElement(unsigned line, unsigned column, std::string_view text) { record("nextElement", line, column, text); }
+        void null(unsigned line, unsigned column, std::string_view text) { record("null", line, column, text); }
+        void number(unsigned line, unsigned column, std::string_view number) { record("number", line, column, number); }
+        void space(unsigned line, unsigned column, std::string_view text) { record("space", line, column, text); }
+        void startArray(unsigned line, unsigned column, std::string_view text) { record("startArray", line, column, text); }
+        void startDocument() { events.append("startDocument\n"); }
+        void startObject(unsigned line, unsigned column, std::string_view text) { record("startObject", line, column, text); }
+        void string(unsigned line, unsigned column, std::string_view text) { record("string", line, column, text); }
+        void decodedString(unsigned line, unsigned column, std::string_view text) { record("decodedString", line, column, text); }
+
+        void decodedNumber(unsigned line, unsigned column, const libJSON::JSONNumber & number)
+        {
+            char buffer[64];
+            if (number.type == libJSON::JSONNumber::INTEGER)
+                std::snprintf(buffer, sizeof(buffer), "integer %lld", static_cast<long long>(number.integer));
+            else if (number.type == libJSON::JSONNumber::UNSIGNED)
+                std::snprintf(buffer, sizeof(buffer), "unsigned %llu", static_cast<unsigned long long>(number.unsignedInteger));
+            else
+                std::snprintf(buffer, sizeof(buffer), "real %.17g%s", number.real, number.overflow ? " overflow" : "");
+            record("decodedNumber", line, column, buffer);
+        }
+    };
+
+    ///
+    /// Valid and invalid documents for the edge cases of the tokenizer and the parse table.
+    ///
+    inline const std::vector<std::string> & edgeCases()
+    {
+        static const std::vector<std::string> documents = {
+            "", "null", "true", "false", "0", "-0.1e-01", "12345678901234567890123", "\"\"", "\"{}\"",
+            "\"\\r\\\\\\n\\u0020\\u00e9\\ud83d\\ude00\\ud800\"", "\"caf\xc3\xa9\"", "[]", "{}", "[1,2,3]", "  [ 1 , 2 ]  \n",
+            "{\n  \"id\": -0.1e-01,\n  \"node_id\": \"MDEwOlJlcG9zaXRvcnk2OTE1NTc1OA==\"\n}",
+            "{\"a\":{\"b\":{\"c\":[{\"d\":1},{\"e\":\"x\"}]}}, \"f\" : [ ] }",
+            "[1, [2, [3, {\"a\": [true, false, null]}]], {}]",
+            " \n [ {\"a\\n\\u00e9\": [1, {\"b\": \"x,y\"}]},\n\t-2.5e3 , \"q\\\"]\", null, true ] \n",
+            "[\"a,b\", \"[\", \"]\", \"{\", \"}\", \"\\\\\", \"\\\"\"]\r\n",
+            "[1 2]", "true true", "[1,]", "{\"a\" 1}", "{]", "]", "{\"a\":1,}", "[", "{\"a\":", "-", "-x",
+            "\"\\x0\"", "\"\\u00XX\"", "A0123", "0123A", "123 \n ABC", "[]{}:,.+-", "+123.456e01", "-0123.456e01",
+            "-0.e-01", "{\"a\":1}{\"b\":2}", "[1,x,2]", "{,}", "{\"a\":1 \"b\":2}", "[\"a\" \"b\"]", "[[[[]]]]]",
+            "[\"unterminated", "[1.5e", "[tru]", "[nul, 1]", "[\"\x01\"]", "[1]\n[2]\n\n  \n{\"a\": [3]}\n",
+        };
+        return documents;
+    }
+
+    ///
+    /// Replaces, removes or inserts a few structural characters, which mostly makes a document invalid.
+    ///
+    inline std::string mutate(std::string document, std::mt19937 & random)
+    {
+        static const char alphabet[] = "[]{},:\"\\ \n01-.eEtrufalsn\x01u9";
+        for (unsigned n = random() % 4; n && !document.empty(); --n)
+        {
+            std::size_t position = random() % document.size();
+            char c = alphabet[random() % (sizeof(alphabet) - 1)];
+            switch (random() % 3)
+            {
+                case 0:
+                    document[position] = c;
+                    break;
+                case 1:
+                    document.erase(position, 1);
+                    break;
+                default:
+                    document.insert(position, 1, c);
+                    break;
+            }
+        }
+        return document;
+    }
+
+    ///
+    /// Generates the elements of a large array on demand, so the document is never held in memory.
+    ///
+    struct GeneratedArray : public std::streambuf
+    {
+        std::size_t size;
+        std::size_t generated;
+        unsigned next;
+        bool closed;
+        std::string chunk;
+
+        GeneratedArray(std::size_t size) : size(size), generated(0), next(0), closed(false) {}
+
+        virtual int_type underflow()
+        {
+            if (gptr() < egptr())
+                return traits_type::to_int_type(*gptr());
+            chunk.clear();
+            if (next == 0)
+                chunk.append("[");
+            while (generated + chunk.size() < size && chunk.size() < 64 * 1024)
+            {
+                if (next)
+                    chunk.append(",\n");
+                chunk.append("{\"id\": ").append(std::to_string(next))
+                     .append(", \"name\": \"item \\\"").append(std::to_string(next))
+                     .append("\\\"\", \"tags\": [true, false, null, -1.5e-3]}");
+                ++next;
+            }
+            if (generated + chunk.size() >= size && !closed)
+            {
+                chunk.append("]");
+                closed = true;
+            }
+            if (chunk.empty())
+                return traits_type::eof();
+            generated += chunk.size();
+            setg(&chunk[0], &chunk[0], &chunk[0] + chunk.size());
+            return traits_type::to_int_type(*gptr());
+        }
+    };
+
+    ///
+    /// @return the peak resident memory of the process so far, which never shrinks
+    ///
+    inline std::size_t peakResidentKilobytes()
+    {
+        struct rusage usage;
+        getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+        return usage.ru_maxrss / 1024;
+#else
+        return usage.ru_maxrss;
+#endif
+    }
+}
+
+#endif // JSONTestSupport_hxx